@@ -18,7 +18,21 @@ struct Settings
   uint16_t Version = 0x0001;
 } DeviceSettings;
 
-EEPROManager<Settings> manageDeviceSettings(&DeviceSettings, 0x0001);
+/**
+ * @brief Settings holds a String, so it is serialised into a fixed size entry: up to 16 ID characters and the Version
+ * 
+ */
+template <> struct EEPROManagerLayout<Settings>
+{
+  static const uint16_t SIZE = 1 + 16 + sizeof(uint16_t);
+  template <class CODER> static void visit(CODER &coder, Settings &settings)
+  {
+    coder.string(settings.ID, 16);
+    coder.value(settings.Version);
+  }
+};
+
+EEPROManagerSerial<Settings> manageDeviceSettings(&DeviceSettings, 0x0001);
 
 /**
  * @brief Initial Setup
@@ -29,7 +43,7 @@ EEPROManager<Settings> manageDeviceSettings(&DeviceSettings, 0x0001);
  */
 void setup()
 {
-  Serial.being(9600);
+  Serial.begin(9600);
 }
 
 /**
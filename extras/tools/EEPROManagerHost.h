@@ -0,0 +1,348 @@
+/**
+ * @file EEPROManagerHost.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Host side helpers shared by the EEPROManager tools
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Mirrors the EEPROM ENTRY layout written by EEPROManager so images, dumps and traces captured on a board can
+ * be processed on a Linux host with nothing but a C++11 compiler. An EEPROM ENTRY is stored little endian as:
+ *   KEY (2) | CRC8 of the low KEY byte (1) | WRITE_COUNT (4) | LENGTH (2) | DATA (LENGTH) | CRC32 of DATA (4)
+ * CRCs use the defaults of the Arduino CRC library (CRC8 polynome 0xD5, CRC32 polynome 0x04C11DB7, zero start and
+ * end masks, no reflection).
+ */
+
+#ifndef EEPROManagerHost_h
+
+  #define EEPROManagerHost_h
+
+  #include <stdint.h>
+  #include <stddef.h>
+  #include <stdio.h>
+  #include <string.h>
+  #include <vector>
+
+  #ifndef EEPROM_MAX_WRITES
+    #define EEPROM_MAX_WRITES 100000
+  #endif
+
+  namespace EEPROManagerHost
+  {
+    const uint16_t HEADER_SIZE = 2 + 1 + 4 + 2;         // KEY, CRC8, WRITE_COUNT and LENGTH
+    const uint16_t ENTRY_OVERHEAD = HEADER_SIZE + 4;    // Header plus trailing CRC32
+
+    /**
+     * @brief EEPROM ENTRY header decoded from an image
+     * 
+     */
+    struct Entry
+    {
+      uint16_t ADDRESS;                                 // Starting ADDRESS of the EEPROM ENTRY
+      uint16_t KEY;                                     // Unique KEY of the EEPROM ENTRY
+      uint32_t WRITE_COUNT;                             // WRITE_COUNT of the EEPROM ENTRY
+      uint16_t LENGTH;                                  // LENGTH of the EEPROM ENTRY data
+      uint32_t CRC32;                                   // Stored CRC32 of the data
+      bool TRUNCATED;                                   // Entry extends past the end of the image
+      bool VALID;                                       // Stored CRC32 matches the data
+      bool RETIRED;                                     // WRITE_COUNT reached MAX_WRITES so the entry was abandoned
+    };
+
+    /**
+     * @brief Calculates a CRC8 identical to crc8() of the Arduino CRC library
+     * 
+     * @param DATA Bytes to hash
+     * @param LENGTH Number of bytes
+     * @return uint8_t CRC8
+     */
+    inline uint8_t crc8(const uint8_t *DATA, size_t LENGTH)
+    {
+      uint8_t crc = 0;
+      while (LENGTH--)
+      {
+        crc ^= *DATA++;
+        for (uint8_t i = 0; i < 8; i++)
+        {
+          crc = (crc & 0x80) ? (crc << 1) ^ 0xD5 : (crc << 1);
+        }
+      }
+      return crc;
+    }
+
+    /**
+     * @brief Calculates a CRC32 identical to crc32() of the Arduino CRC library
+     * 
+     * @details Table driven as the analyser hashes every entry of thousands of images. Passing the previous result
+     * as START continues the calculation as the library applies no final mask or reflection.
+     * 
+     * @param DATA Bytes to hash
+     * @param LENGTH Number of bytes
+     * @param START CRC to continue from
+     * @return uint32_t CRC32
+     */
+    inline uint32_t crc32(const uint8_t *DATA, size_t LENGTH, uint32_t START = 0)
+    {
+      struct Table
+      {
+        uint32_t VALUES[256];
+        Table()
+        {
+          for (uint32_t i = 0; i < 256; i++)
+          {
+            uint32_t value = i << 24;
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+              value = (value & 0x80000000UL) ? (value << 1) ^ 0x04C11DB7UL : (value << 1);
+            }
+            VALUES[i] = value;
+          }
+        }
+      };
+      static const Table table;
+      uint32_t crc = START;
+      while (LENGTH--)
+      {
+        crc = (crc << 8) ^ table.VALUES[((crc >> 24) ^ *DATA++) & 0xFF];
+      }
+      return crc;
+    }
+
+    /**
+     * @brief Reads a little endian value from a byte buffer
+     * 
+     */
+    inline uint16_t get16(const uint8_t *DATA) { return DATA[0] | (DATA[1] << 8); }
+    inline uint32_t get32(const uint8_t *DATA) { return DATA[0] | (DATA[1] << 8) | (DATA[2] << 16) | (static_cast<uint32_t>(DATA[3]) << 24); }
+
+    /**
+     * @brief Writes a little endian value into a byte buffer
+     * 
+     */
+    inline void put16(uint8_t *DATA, uint16_t VALUE) { DATA[0] = VALUE; DATA[1] = VALUE >> 8; }
+    inline void put32(uint8_t *DATA, uint32_t VALUE) { for (uint8_t i = 0; i < 4; i++) DATA[i] = VALUE >> (8 * i); }
+
+    /**
+     * @brief Walks the EEPROM ENTRY chain of an image the same way EEPROManager::locate() does
+     * 
+     * @param IMAGE EEPROM image
+     * @param SIZE Size of the image in bytes
+     * @param ENTRIES Receives every EEPROM ENTRY found, including retired ones
+     * @param MAX_WRITES EEPROM_MAX_WRITES of the firmware which wrote the image
+     * @return uint32_t ADDRESS of the first byte of uninitialised space
+     */
+    inline uint32_t parse(const uint8_t *IMAGE, uint32_t SIZE, std::vector<Entry> &ENTRIES, uint32_t MAX_WRITES = EEPROM_MAX_WRITES)
+    {
+      uint32_t address = 0;
+      while (address + HEADER_SIZE <= SIZE && crc8(IMAGE + address, 1) == IMAGE[address + 2])
+      {
+        Entry entry = {};
+        entry.ADDRESS = address;
+        entry.KEY = get16(IMAGE + address);
+        entry.WRITE_COUNT = get32(IMAGE + address + 3);
+        entry.LENGTH = get16(IMAGE + address + 7);
+        entry.RETIRED = entry.WRITE_COUNT >= MAX_WRITES;
+        if (address + ENTRY_OVERHEAD + entry.LENGTH > SIZE)
+        {
+          entry.TRUNCATED = true;
+          ENTRIES.push_back(entry);
+          return SIZE;
+        }
+        entry.CRC32 = get32(IMAGE + address + HEADER_SIZE + entry.LENGTH);
+        entry.VALID = crc32(IMAGE + address + HEADER_SIZE, entry.LENGTH) == entry.CRC32;
+        ENTRIES.push_back(entry);
+        address += ENTRY_OVERHEAD + entry.LENGTH;
+      }
+      return address;
+    }
+
+    /**
+     * @brief Appends a complete EEPROM ENTRY to an image
+     * 
+     * @param IMAGE Image to append to
+     * @param KEY Unique KEY of the EEPROM ENTRY
+     * @param DATA Entry data
+     * @param LENGTH Number of data bytes
+     * @param WRITE_COUNT WRITE_COUNT to store
+     */
+    inline void append(std::vector<uint8_t> &IMAGE, uint16_t KEY, const uint8_t *DATA, uint16_t LENGTH, uint32_t WRITE_COUNT = 1)
+    {
+      size_t address = IMAGE.size();
+      IMAGE.resize(address + ENTRY_OVERHEAD + LENGTH);
+      uint8_t *entry = &IMAGE[address];
+      put16(entry, KEY);
+      entry[2] = crc8(entry, 1);
+      put32(entry + 3, WRITE_COUNT);
+      put16(entry + 7, LENGTH);
+      memcpy(entry + HEADER_SIZE, DATA, LENGTH);
+      put32(entry + HEADER_SIZE + LENGTH, crc32(DATA, LENGTH));
+    }
+
+    /**
+     * @brief Appends a frame in the format read by EEPROManagerFrame::receive()
+     * 
+     * @param STREAM Frame stream to append to
+     * @param TYPE Frame type
+     * @param ADDRESS Frame ADDRESS (the KEY for ENTRY frames)
+     * @param PAYLOAD Payload bytes
+     * @param LENGTH Number of payload bytes, at most EEPROMANAGER_FRAME_CHUNK of the receiving board
+     */
+    inline void frame(std::vector<uint8_t> &STREAM, uint8_t TYPE, uint16_t ADDRESS, const uint8_t *PAYLOAD, uint8_t LENGTH)
+    {
+      size_t start = STREAM.size();
+      STREAM.resize(start + 9 + LENGTH);
+      uint8_t *frame = &STREAM[start];
+      frame[0] = 0x7E;
+      frame[1] = TYPE;
+      put16(frame + 2, ADDRESS);
+      frame[4] = LENGTH;
+      memcpy(frame + 5, PAYLOAD, LENGTH);
+      put32(frame + 5 + LENGTH, crc32(frame + 1, 4 + LENGTH));
+    }
+
+    /**
+     * @brief EEPROM image rebuilt from a framed dump
+     * 
+     */
+    struct Dump
+    {
+      std::vector<uint8_t> IMAGE;                       // EEPROM contents, bytes not sent are left erased (0xFF)
+      bool LIVE_ONLY;                                   // Only the live EEPROM ENTRIES were sent
+      bool COMPLETE;                                    // The END frame was received and the frame count matched
+      uint32_t FRAMES;                                  // Number of valid frames received
+      uint32_t CORRUPT;                                 // Number of frames rejected by their CRC32
+    };
+
+    /**
+     * @brief Finds the next valid frame in a capture
+     * 
+     * @details Bytes outside frames (other serial output) are skipped so captures can be taken from a shared console.
+     * 
+     * @param CAPTURE Raw capture
+     * @param POSITION Offset to search from, advanced past the frame returned
+     * @param TYPE Receives the frame type
+     * @param ADDRESS Receives the frame ADDRESS
+     * @param PAYLOAD Receives a pointer to the payload within CAPTURE
+     * @param LENGTH Receives the number of payload bytes
+     * @param CORRUPT Incremented for every frame rejected by its CRC32
+     * @return true A frame was found
+     * @return false The end of the capture was reached
+     */
+    inline bool next(const std::vector<uint8_t> &CAPTURE, size_t &POSITION, uint8_t &TYPE, uint16_t &ADDRESS, const uint8_t *&PAYLOAD, uint8_t &LENGTH, uint32_t &CORRUPT)
+    {
+      while (POSITION + 9 <= CAPTURE.size())
+      {
+        const uint8_t *frame = &CAPTURE[POSITION];
+        uint8_t length = frame[4];
+        if (frame[0] != 0x7E || POSITION + 9 + length > CAPTURE.size())
+        {
+          POSITION++;
+          continue;
+        }
+        if (crc32(frame + 1, 4 + length) != get32(frame + 5 + length))
+        {
+          if (frame[1] == 'D' || frame[1] == 'F' || frame[1] == 'R' || frame[1] == 'E')
+          {
+            CORRUPT++;
+          }
+          POSITION++;
+          continue;
+        }
+        TYPE = frame[1];
+        ADDRESS = get16(frame + 2);
+        PAYLOAD = frame + 5;
+        LENGTH = length;
+        POSITION += 9 + length;
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief Rebuilds the EEPROM images contained in a capture of EEPROManagerFrame::dump() output
+     * 
+     * @param CAPTURE Raw capture
+     * @param DUMPS Receives one image per HEADER frame found
+     */
+    inline void decode(const std::vector<uint8_t> &CAPTURE, std::vector<Dump> &DUMPS)
+    {
+      size_t position = 0;
+      uint8_t type;
+      uint16_t address;
+      const uint8_t *payload;
+      uint8_t length;
+      uint32_t corrupt = 0;
+      Dump *dump = NULL;
+      while (next(CAPTURE, position, type, address, payload, length, corrupt))
+      {
+        switch (type)
+        {
+          case 'H':
+            DUMPS.push_back(Dump());
+            dump = &DUMPS.back();
+            dump->IMAGE.assign(get16(payload), 0xFF);
+            dump->LIVE_ONLY = payload[2] & 0x01;
+            dump->COMPLETE = false;
+            dump->FRAMES = 1;
+            dump->CORRUPT = 0;
+            corrupt = 0;
+            break;
+          case 'D':
+            if (dump && address + length <= dump->IMAGE.size())
+            {
+              memcpy(&dump->IMAGE[address], payload, length);
+              dump->FRAMES++;
+            }
+            break;
+          case 'F':
+            if (dump && address + get16(payload) <= dump->IMAGE.size())
+            {
+              memset(&dump->IMAGE[address], payload[2], get16(payload));
+              dump->FRAMES++;
+            }
+            break;
+          case 'Z':
+            if (dump)
+            {
+              dump->FRAMES++;
+              dump->CORRUPT = corrupt;
+              dump->COMPLETE = corrupt == 0 && dump->FRAMES == get16(payload);
+              dump = NULL;
+            }
+            break;
+        }
+      }
+      if (dump)
+      {
+        dump->CORRUPT = corrupt;
+      }
+    }
+
+    /**
+     * @brief Reads a whole file into memory
+     * 
+     * @param PATH File to read
+     * @param CONTENTS Receives the file contents
+     * @return true The file was read
+     * @return false The file could not be opened
+     */
+    inline bool load(const char *PATH, std::vector<uint8_t> &CONTENTS)
+    {
+      FILE *file = fopen(PATH, "rb");
+      if (!file)
+      {
+        return false;
+      }
+      uint8_t buffer[4096];
+      size_t count;
+      CONTENTS.clear();
+      while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+      {
+        CONTENTS.insert(CONTENTS.end(), buffer, buffer + count);
+      }
+      fclose(file);
+      return true;
+    }
+  }
+
+#endif
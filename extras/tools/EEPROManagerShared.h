@@ -0,0 +1,260 @@
+/**
+ * @file EEPROManagerShared.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Thread-safe EEPROM image for host simulations and gateways
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details SharedImage edits an EEPROManager formatted image from many threads without a global mutex around every
+ * call. Each attached EEPROM ENTRY owns a mutex, so threads updating different entries never wait for each other as
+ * the data of two entries never shares a byte. Fresh space for new and relocated entries is claimed with an atomic
+ * bump of the end of the entry chain. The device lock is only taken to attach entries and by commit(), which then
+ * takes every entry lock in attach order to copy out a consistent image (lock order is always device then entry).
+ */
+
+#ifndef EEPROManagerShared_h
+
+  #define EEPROManagerShared_h
+
+  #include "EEPROManagerHost.h"
+
+  #include <atomic>
+  #include <memory>
+  #include <mutex>
+
+  namespace EEPROManagerHost
+  {
+    /**
+     * @brief EEPROManager formatted image shared between threads
+     * 
+     */
+    class SharedImage
+    {
+      public:
+        /**
+         * @brief EEPROM ENTRY attached to a SharedImage, the host counterpart of an EEPROManager instance
+         * 
+         */
+        class Slot
+        {
+          public:
+            uint32_t update(const void *DATA);          // Updates the EEPROM ENTRY if DATA differs from it
+            void read(void *DATA);                      // Copies the EEPROM ENTRY data into DATA
+            uint16_t key() const { return _KEY; }       // Returns the unique KEY of the EEPROM ENTRY
+            uint16_t length() const { return _LENGTH; } // Returns the LENGTH of the EEPROM ENTRY data
+
+          private:
+            friend class SharedImage;
+            Slot(SharedImage *IMAGE, uint16_t KEY, uint16_t LENGTH) : _IMAGE(IMAGE), _KEY(KEY), _LENGTH(LENGTH) {}
+            bool initialise(const void *DATA);          // Claims fresh space and writes a new EEPROM ENTRY
+
+            SharedImage *_IMAGE;
+            std::mutex _LOCK;                           // Entry lock, held while the EEPROM ENTRY is read or written
+            uint16_t _KEY;
+            uint16_t _LENGTH;
+            uint32_t _ADDRESS = 0;
+            uint32_t _WRITE_COUNT = 0;
+            uint32_t _CRC32 = 0;
+        };
+
+        explicit SharedImage(const std::vector<uint8_t> &IMAGE);
+        Slot* attach(uint16_t KEY, uint16_t LENGTH);    // Attaches an EEPROM ENTRY, creating it erased to zero if missing
+        bool commit(std::vector<uint8_t> &IMAGE);       // Copies out a consistent image if anything changed since the last commit
+        uint32_t commits() const { return _COMMITS; }   // Returns the number of commits which copied out an image
+        uint32_t free() const;                          // Returns the bytes left after the end of the entry chain
+
+      private:
+        bool claim(uint32_t SIZE, uint32_t &ADDRESS);   // Claims SIZE bytes of fresh space without taking a lock
+
+        std::vector<uint8_t> _IMAGE;                    // Never resized so entries may write their own bytes concurrently
+        std::mutex _DEVICE;                             // Device lock, guards _SLOTS and commit()
+        std::vector<std::unique_ptr<Slot> > _SLOTS;
+        std::vector<Entry> _ENTRIES;                    // EEPROM ENTRIES found at construction
+        std::atomic<uint32_t> _END;                     // ADDRESS of the first byte of uninitialised space
+        std::atomic<bool> _DIRTY;                       // An entry was written since the last commit
+        std::atomic<uint32_t> _COMMITS;                 // Number of commits which copied out an image
+    };
+
+    /**
+     * @brief Construct a new SharedImage from an existing (or erased) image
+     * 
+     * @param IMAGE EEPROM image, its size is the EEPROM size
+     */
+    inline SharedImage::SharedImage(const std::vector<uint8_t> &IMAGE) : _IMAGE(IMAGE), _END(0), _DIRTY(false), _COMMITS(0)
+    {
+      _END = parse(_IMAGE.data(), _IMAGE.size(), _ENTRIES);
+    }
+
+    /**
+     * @brief Attaches an EEPROM ENTRY the same way EEPROManager::begin() does
+     * 
+     * @param KEY Unique KEY of the EEPROM ENTRY
+     * @param LENGTH Number of data bytes
+     * @return Slot* Attached EEPROM ENTRY, NULL if it does not fit into the image
+     */
+    inline SharedImage::Slot* SharedImage::attach(uint16_t KEY, uint16_t LENGTH)
+    {
+      std::lock_guard<std::mutex> device(_DEVICE);
+      for (size_t i = 0; i < _SLOTS.size(); i++)
+      {
+        if (_SLOTS[i]->_KEY == KEY && _SLOTS[i]->_LENGTH == LENGTH)
+        {
+          return _SLOTS[i].get();
+        }
+      }
+      std::unique_ptr<Slot> slot(new Slot(this, KEY, LENGTH));
+      for (size_t i = 0; i < _ENTRIES.size(); i++)
+      {
+        // Entries found at construction are only ever written through their Slot, so these are still unchanged
+        const Entry &entry = _ENTRIES[i];
+        if (entry.KEY == KEY && entry.LENGTH == LENGTH && !entry.RETIRED && entry.VALID)
+        {
+          slot->_ADDRESS = entry.ADDRESS;
+          slot->_WRITE_COUNT = entry.WRITE_COUNT;
+          slot->_CRC32 = entry.CRC32;
+          _SLOTS.push_back(std::move(slot));
+          return _SLOTS.back().get();
+        }
+      }
+      std::vector<uint8_t> zero(LENGTH, 0);
+      if (!slot->initialise(zero.data()))
+      {
+        return NULL;
+      }
+      _SLOTS.push_back(std::move(slot));
+      return _SLOTS.back().get();
+    }
+
+    /**
+     * @brief Claims fresh space at the end of the entry chain
+     * 
+     * @param SIZE Number of bytes to claim
+     * @param ADDRESS Receives the ADDRESS of the claimed space
+     * @return true The space was claimed
+     * @return false Not enough space is left
+     */
+    inline bool SharedImage::claim(uint32_t SIZE, uint32_t &ADDRESS)
+    {
+      uint32_t end = _END.load();
+      do
+      {
+        if (end + SIZE > _IMAGE.size())
+        {
+          return false;
+        }
+      }
+      while (!_END.compare_exchange_weak(end, end + SIZE));
+      ADDRESS = end;
+      return true;
+    }
+
+    /**
+     * @brief Returns the bytes left after the end of the entry chain
+     * 
+     * @return uint32_t Free bytes
+     */
+    inline uint32_t SharedImage::free() const
+    {
+      uint32_t end = _END.load();
+      return end < _IMAGE.size() ? _IMAGE.size() - end : 0;
+    }
+
+    /**
+     * @brief Copies out a consistent image, the host counterpart of EEPROM.commit()
+     * 
+     * @param IMAGE Receives the image
+     * @return true An image was copied out
+     * @return false Nothing changed since the last commit
+     */
+    inline bool SharedImage::commit(std::vector<uint8_t> &IMAGE)
+    {
+      std::lock_guard<std::mutex> device(_DEVICE);
+      if (!_DIRTY.exchange(false))
+      {
+        return false;
+      }
+      for (size_t i = 0; i < _SLOTS.size(); i++)
+      {
+        _SLOTS[i]->_LOCK.lock();
+      }
+      IMAGE = _IMAGE;
+      for (size_t i = _SLOTS.size(); i > 0; i--)
+      {
+        _SLOTS[i - 1]->_LOCK.unlock();
+      }
+      _COMMITS++;
+      return true;
+    }
+
+    /**
+     * @brief Claims fresh space and writes a new EEPROM ENTRY with a WRITE_COUNT of 1
+     * 
+     * @param DATA Entry data
+     * @return true The EEPROM ENTRY was written
+     * @return false No space is left
+     */
+    inline bool SharedImage::Slot::initialise(const void *DATA)
+    {
+      uint32_t address;
+      if (!_IMAGE->claim(ENTRY_OVERHEAD + _LENGTH, address))
+      {
+        return false;
+      }
+      uint8_t *entry = &_IMAGE->_IMAGE[address];
+      _ADDRESS = address;
+      _WRITE_COUNT = 1;
+      _CRC32 = crc32(static_cast<const uint8_t*>(DATA), _LENGTH);
+      put16(entry, _KEY);
+      entry[2] = crc8(entry, 1);
+      put32(entry + 3, _WRITE_COUNT);
+      put16(entry + 7, _LENGTH);
+      memcpy(entry + HEADER_SIZE, DATA, _LENGTH);
+      put32(entry + HEADER_SIZE + _LENGTH, _CRC32);
+      _IMAGE->_DIRTY = true;
+      return true;
+    }
+
+    /**
+     * @brief Updates the EEPROM ENTRY if DATA differs from it, only the entry lock is taken
+     * 
+     * @param DATA Entry data, length() bytes
+     * @return uint32_t 0 if unchanged, WRITE_COUNT if written, 0xFFFFFFFF if relocation found no space
+     */
+    inline uint32_t SharedImage::Slot::update(const void *DATA)
+    {
+      uint32_t memoryCRC32 = crc32(static_cast<const uint8_t*>(DATA), _LENGTH);
+      std::lock_guard<std::mutex> lock(_LOCK);
+      if (memoryCRC32 == _CRC32)
+      {
+        return 0;
+      }
+      uint8_t *entry = &_IMAGE->_IMAGE[_ADDRESS];
+      _WRITE_COUNT++;
+      _CRC32 = memoryCRC32;
+      put32(entry + 3, _WRITE_COUNT);
+      memcpy(entry + HEADER_SIZE, DATA, _LENGTH);
+      put32(entry + HEADER_SIZE + _LENGTH, _CRC32);
+      _IMAGE->_DIRTY = true;
+      if (_WRITE_COUNT >= EEPROM_MAX_WRITES)
+      {
+        // Write count has been exceeded: the retired entry stays in place and a new one is appended
+        return initialise(DATA) ? _WRITE_COUNT : 0xFFFFFFFF;
+      }
+      return _WRITE_COUNT;
+    }
+
+    /**
+     * @brief Copies the EEPROM ENTRY data
+     * 
+     * @param DATA Receives length() bytes
+     */
+    inline void SharedImage::Slot::read(void *DATA)
+    {
+      std::lock_guard<std::mutex> lock(_LOCK);
+      memcpy(DATA, &_IMAGE->_IMAGE[_ADDRESS + HEADER_SIZE], _LENGTH);
+    }
+  }
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file Arduino.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Minimal Arduino core for compiling the EEPROManager library into host tools
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Provides just what EEPROManager.h uses: timing, String, Print and Stream. Tools that run the library itself
+ * add this directory and src to the include path: g++ -std=c++11 -Iarduino -I../../src ...
+ */
+
+#ifndef EEPROManagerArduino_h
+
+  #define EEPROManagerArduino_h
+
+  #include <stdint.h>
+  #include <stddef.h>
+  #include <stdio.h>
+  #include <stdarg.h>
+  #include <string.h>
+  #include <math.h>
+  #include <chrono>
+  #include <string>
+
+  typedef uint8_t byte;
+
+  inline unsigned long micros()
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  inline unsigned long millis()
+  {
+    return micros() / 1000;
+  }
+
+  /**
+   * @brief String with the members used by EEPROManagerEncoder and EEPROManagerDecoder
+   * 
+   */
+  class String
+  {
+    public:
+      String(const char *TEXT = "") : _TEXT(TEXT) {}
+      unsigned int length() const { return _TEXT.size(); }
+      char charAt(unsigned int INDEX) const { return INDEX < _TEXT.size() ? _TEXT[INDEX] : 0; }
+      const char* c_str() const { return _TEXT.c_str(); }
+      bool reserve(unsigned int SIZE) { _TEXT.reserve(SIZE); return true; }
+      bool concat(char CHARACTER) { _TEXT.push_back(CHARACTER); return true; }
+      String& operator=(const char *TEXT) { _TEXT = TEXT; return *this; }
+
+    private:
+      std::string _TEXT;
+  };
+
+  /**
+   * @brief Output half of a Stream, written to stdout unless a tool overrides write()
+   * 
+   */
+  class Print
+  {
+    public:
+      virtual ~Print() {}
+      virtual size_t write(uint8_t VALUE) { return fputc(VALUE, stdout) == EOF ? 0 : 1; }
+      virtual size_t write(const uint8_t *BUFFER, size_t SIZE)
+      {
+        size_t written = 0;
+        for (size_t i = 0; i < SIZE; i++)
+        {
+          written += write(BUFFER[i]);
+        }
+        return written;
+      }
+      size_t printf(const char *FORMAT, ...) __attribute__((format(printf, 2, 3)))
+      {
+        char text[256];
+        va_list arguments;
+        va_start(arguments, FORMAT);
+        vsnprintf(text, sizeof(text), FORMAT, arguments);
+        va_end(arguments);
+        return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+      }
+  };
+
+  /**
+   * @brief Stream reading from a byte string, a tool fills INPUT before passing the Stream to import()
+   * 
+   */
+  class Stream : public Print
+  {
+    public:
+      virtual int available() { return INPUT.size() - _POSITION; }
+      virtual int read() { return _POSITION < INPUT.size() ? static_cast<uint8_t>(INPUT[_POSITION++]) : -1; }
+      size_t readBytes(uint8_t *BUFFER, size_t SIZE)
+      {
+        size_t count = 0;
+        while (count < SIZE && _POSITION < INPUT.size())
+        {
+          BUFFER[count++] = INPUT[_POSITION++];
+        }
+        return count;
+      }
+      void setTimeout(unsigned long) {}
+
+      std::string INPUT;                                // Bytes returned by read() and readBytes()
+
+    private:
+      size_t _POSITION = 0;
+  };
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file CRC.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief crc8() and crc32() of the Arduino CRC library for compiling the EEPROManager library into host tools
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Bitwise implementations with the library signatures. Only the defaults used by EEPROManager (no
+ * reflection, END applied as an XOR mask) are supported.
+ */
+
+#ifndef EEPROManagerCRC_h
+
+  #define EEPROManagerCRC_h
+
+  #include <Arduino.h>
+
+  inline uint8_t crc8(const uint8_t *DATA, uint16_t LENGTH, uint8_t POLYNOME = 0xD5, uint8_t START = 0, uint8_t END = 0,
+    bool = false, bool = false)
+  {
+    uint8_t crc = START;
+    while (LENGTH--)
+    {
+      crc ^= *DATA++;
+      for (uint8_t bit = 0; bit < 8; bit++)
+      {
+        crc = (crc & 0x80) ? (crc << 1) ^ POLYNOME : (crc << 1);
+      }
+    }
+    return crc ^ END;
+  }
+
+  inline uint32_t crc32(const uint8_t *DATA, uint16_t LENGTH, uint32_t POLYNOME = 0x04C11DB7, uint32_t START = 0,
+    uint32_t END = 0, bool = false, bool = false)
+  {
+    uint32_t crc = START;
+    while (LENGTH--)
+    {
+      crc ^= static_cast<uint32_t>(*DATA++) << 24;
+      for (uint8_t bit = 0; bit < 8; bit++)
+      {
+        crc = (crc & 0x80000000UL) ? (crc << 1) ^ POLYNOME : (crc << 1);
+      }
+    }
+    return crc ^ END;
+  }
+
+#endif
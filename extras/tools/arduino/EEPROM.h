@@ -0,0 +1,44 @@
+/**
+ * @file EEPROM.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief RAM backed EEPROM for compiling the EEPROManager library into host tools
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Erased to 0xFF like a fresh device. The size defaults to 4096 bytes and is set with
+ * EEPROMANAGER_HOST_EEPROM_SIZE (at most 65535, the library addresses the EEPROM with 16 bits).
+ */
+
+#ifndef EEPROManagerEEPROM_h
+
+  #define EEPROManagerEEPROM_h
+
+  #include <Arduino.h>
+
+  #ifndef EEPROMANAGER_HOST_EEPROM_SIZE
+    #define EEPROMANAGER_HOST_EEPROM_SIZE 4096
+  #endif
+
+  /**
+   * @brief EEPROM with the interface of the AVR EEPROM library
+   * 
+   */
+  class EEPROMClass
+  {
+    public:
+      EEPROMClass() { memset(BYTES, 0xFF, sizeof(BYTES)); }
+      uint8_t read(int ADDRESS) { return BYTES[ADDRESS]; }
+      void write(int ADDRESS, uint8_t VALUE) { BYTES[ADDRESS] = VALUE; }
+      void update(int ADDRESS, uint8_t VALUE) { BYTES[ADDRESS] = VALUE; }
+      uint16_t length() { return sizeof(BYTES); }
+      template <class V> V& get(int ADDRESS, V &VALUE) { memcpy(static_cast<void*>(&VALUE), BYTES + ADDRESS, sizeof(V)); return VALUE; }
+      template <class V> const V& put(int ADDRESS, const V &VALUE) { memcpy(BYTES + ADDRESS, static_cast<const void*>(&VALUE), sizeof(V)); return VALUE; }
+
+      uint8_t BYTES[EEPROMANAGER_HOST_EEPROM_SIZE];     // EEPROM contents
+  };
+
+  static EEPROMClass EEPROM;
+
+#endif
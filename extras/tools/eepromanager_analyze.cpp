@@ -0,0 +1,228 @@
+/**
+ * @file eepromanager_analyze.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Parses EEPROM images and reports entries, wear, free space and corruption
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Walks every image with the same rules as EEPROManager::locate() and checks it for:
+ *  -# live entries whose CRC32 does not match their data
+ *  -# entries running past the end of the image
+ *  -# more than one live entry with the same KEY (only the first one is ever used)
+ *  -# programmed bytes after the end of the entry chain (torn or foreign writes)
+ * Images are processed by a pool of worker threads so dumps collected from a whole fleet can be triaged at once. Inputs
+ * are raw images, or EEPROManager::dump() captures when --dump is given.
+ * 
+ * Build: g++ -std=c++11 -O2 -pthread -o eepromanager_analyze eepromanager_analyze.cpp
+ * Usage: eepromanager_analyze [-j THREADS] [--summary] [--dump] [--max-writes COUNT] IMAGE...
+ * Exit status is 2 when any image is corrupt.
+ */
+
+#include "EEPROManagerHost.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+
+using namespace EEPROManagerHost;
+
+/**
+ * @brief Analysis options taken from the command line
+ * 
+ */
+struct Options
+{
+  bool SUMMARY = false;                                 // One line per image instead of the full entry listing
+  bool DUMP = false;                                    // Inputs are dump() captures rather than raw images
+  uint32_t MAX_WRITES = EEPROM_MAX_WRITES;              // WRITE_COUNT at which entries are retired
+};
+
+/**
+ * @brief Appends printf formatted text to a report
+ * 
+ */
+static void append(std::string &REPORT, const char *FORMAT, ...) __attribute__((format(printf, 2, 3)));
+static void append(std::string &REPORT, const char *FORMAT, ...)
+{
+  char line[256];
+  va_list arguments;
+  va_start(arguments, FORMAT);
+  vsnprintf(line, sizeof(line), FORMAT, arguments);
+  va_end(arguments);
+  REPORT += line;
+}
+
+/**
+ * @brief Analyses a single image
+ * 
+ * @param NAME Name used in the report
+ * @param IMAGE EEPROM image
+ * @param OPTIONS Analysis options
+ * @param REPORT Receives the report text
+ * @return true The image is corrupt
+ * @return false No corruption was found
+ */
+static bool analyse(const char *NAME, const std::vector<uint8_t> &IMAGE, const Options &OPTIONS, std::string &REPORT)
+{
+  std::vector<Entry> entries;
+  uint32_t size = IMAGE.size();
+  uint32_t end = parse(IMAGE.data(), size, entries, OPTIONS.MAX_WRITES);
+  uint32_t live = 0;
+  uint32_t retired = 0;
+  uint32_t problems = 0;
+  uint64_t writes = 0;
+  double hottest = 0;
+  uint32_t largest = 0;
+  std::set<uint16_t> keys;
+  std::string details;
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    const Entry &entry = entries[i];
+    const char *status = "ok";
+    writes += entry.RETIRED ? OPTIONS.MAX_WRITES : entry.WRITE_COUNT;
+    if (entry.TRUNCATED)
+    {
+      status = "TRUNCATED";
+      problems++;
+    }
+    else if (entry.RETIRED)
+    {
+      status = "retired";
+      retired++;
+    }
+    else
+    {
+      live++;
+      double wear = 100.0 * entry.WRITE_COUNT / OPTIONS.MAX_WRITES;
+      hottest = wear > hottest ? wear : hottest;
+      uint32_t entrySize = ENTRY_OVERHEAD + entry.LENGTH;
+      largest = entrySize > largest ? entrySize : largest;
+      if (!entry.VALID)
+      {
+        status = "CRC32 MISMATCH";
+        problems++;
+      }
+      else if (!keys.insert(entry.KEY).second)
+      {
+        status = "DUPLICATE KEY";
+        problems++;
+      }
+    }
+    append(details, "  @%04X KEY %04X LENGTH %5u WRITE_COUNT %7u (%5.1f%% worn) %s\n", entry.ADDRESS, entry.KEY,
+      entry.LENGTH, entry.WRITE_COUNT, 100.0 * entry.WRITE_COUNT / OPTIONS.MAX_WRITES, status);
+  }
+  uint32_t stray = 0;
+  for (uint32_t i = end; i < size; i++)
+  {
+    stray += IMAGE[i] != 0xFF;
+  }
+  if (stray)
+  {
+    append(details, "  %u programmed bytes after the entry chain at @%04X\n", stray, end);
+    problems++;
+  }
+  uint32_t free = size > end ? size - end : 0;
+  if (OPTIONS.SUMMARY)
+  {
+    append(REPORT, "%s: %u live, %u retired, %u bytes free, %.1f%% hottest wear, %u relocations left for the largest entry, %s\n",
+      NAME, live, retired, free, hottest, largest ? free / largest : 0, problems ? "CORRUPT" : "ok");
+  }
+  else
+  {
+    append(REPORT, "%s: %u bytes, %u live entries, %u retired entries, %u bytes free\n", NAME, size, live, retired, free);
+    REPORT += details;
+    append(REPORT, "  %llu entry writes in total, hottest live entry %.1f%% worn, %u relocations left for the largest entry\n",
+      static_cast<unsigned long long>(writes), hottest, largest ? free / largest : 0);
+    append(REPORT, "  %s\n", problems ? "CORRUPT" : "ok");
+  }
+  return problems != 0;
+}
+
+/**
+ * @brief Loads and analyses one input file, which holds several images in --dump mode
+ * 
+ */
+static bool analyseFile(const char *PATH, const Options &OPTIONS, std::string &REPORT)
+{
+  std::vector<uint8_t> contents;
+  if (!load(PATH, contents))
+  {
+    append(REPORT, "%s: cannot read\n", PATH);
+    return true;
+  }
+  if (!OPTIONS.DUMP)
+  {
+    return analyse(PATH, contents, OPTIONS, REPORT);
+  }
+  std::vector<Dump> dumps;
+  decode(contents, dumps);
+  bool corrupt = dumps.empty();
+  if (dumps.empty())
+  {
+    append(REPORT, "%s: no dump found\n", PATH);
+  }
+  for (size_t i = 0; i < dumps.size(); i++)
+  {
+    char name[512];
+    snprintf(name, sizeof(name), "%s#%zu%s", PATH, i, dumps[i].COMPLETE ? "" : " (INCOMPLETE DUMP)");
+    corrupt = analyse(name, dumps[i].IMAGE, OPTIONS, REPORT) || !dumps[i].COMPLETE || corrupt;
+  }
+  return corrupt;
+}
+
+int main(int argc, char **argv)
+{
+  Options options;
+  unsigned threads = std::thread::hardware_concurrency();
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-j") && i + 1 < argc) threads = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--summary")) options.SUMMARY = true;
+    else if (!strcmp(argv[i], "--dump")) options.DUMP = true;
+    else if (!strcmp(argv[i], "--max-writes") && i + 1 < argc) options.MAX_WRITES = strtoul(argv[++i], NULL, 0);
+    else paths.push_back(argv[i]);
+  }
+  if (paths.empty())
+  {
+    fprintf(stderr, "Usage: %s [-j THREADS] [--summary] [--dump] [--max-writes COUNT] IMAGE...\n", argv[0]);
+    return 1;
+  }
+  threads = threads == 0 ? 1 : threads > paths.size() ? paths.size() : threads;
+
+  // Workers claim files from a shared index, reports are printed in argument order once all are done
+  std::vector<std::string> reports(paths.size());
+  std::vector<char> corrupt(paths.size(), 0);
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; t++)
+  {
+    workers.push_back(std::thread([&]()
+    {
+      for (size_t i = next++; i < paths.size(); i = next++)
+      {
+        corrupt[i] = analyseFile(paths[i], options, reports[i]);
+      }
+    }));
+  }
+  size_t corruptImages = 0;
+  for (size_t t = 0; t < workers.size(); t++)
+  {
+    workers[t].join();
+  }
+  for (size_t i = 0; i < paths.size(); i++)
+  {
+    fputs(reports[i].c_str(), stdout);
+    corruptImages += corrupt[i];
+  }
+  if (paths.size() > 1)
+  {
+    printf("%zu images, %zu corrupt\n", paths.size(), corruptImages);
+  }
+  return corruptImages ? 2 : 0;
+}
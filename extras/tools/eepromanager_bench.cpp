@@ -0,0 +1,192 @@
+/**
+ * @file eepromanager_bench.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Measures update throughput of a SharedImage from 1 to N threads
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Every thread attaches its own entries (or, with --shared, all threads use the same entries) and calls
+ * update() in a tight loop, changing the data on the given percentage of calls, while a committer thread copies out the
+ * image every --commit-ms. Each thread count is run with per-entry locking and, for comparison, with one global mutex
+ * around every call (--global). Throughput is reported per thread count together with the speedup over one thread.
+ * 
+ * Build: g++ -std=c++11 -O2 -pthread -o eepromanager_bench eepromanager_bench.cpp
+ * Usage: eepromanager_bench [-t THREADS] [--entries COUNT] [--length BYTES] [--changed PERCENT] [--seconds S]
+ *                           [--commit-ms MS] [--shared] [--global]
+ */
+
+#include "EEPROManagerShared.h"
+
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+
+using namespace EEPROManagerHost;
+
+/**
+ * @brief Benchmark options taken from the command line
+ * 
+ */
+struct Options
+{
+  unsigned THREADS = std::thread::hardware_concurrency();  // Highest thread count measured
+  unsigned ENTRIES = 4;                                 // Entries per thread (or in total with SHARED)
+  uint16_t LENGTH = 32;                                 // Data bytes per entry
+  unsigned CHANGED = 50;                                // Percentage of update() calls which change the data
+  double SECONDS = 1;                                   // Duration of each run
+  unsigned COMMIT_MS = 10;                              // Commit period
+  bool SHARED = false;                                  // All threads update the same entries
+  bool GLOBAL = false;                                  // Also measure with a global mutex around every call
+};
+
+/**
+ * @brief Result of one run
+ * 
+ */
+struct Result
+{
+  uint64_t UPDATES;                                     // update() calls completed
+  uint64_t WRITES;                                      // update() calls which wrote the entry
+  uint32_t COMMITS;                                     // Commits which copied out an image
+  double SECONDS;                                       // Measured duration
+};
+
+/**
+ * @brief Runs one measurement
+ * 
+ * @param OPTIONS Benchmark options
+ * @param THREADS Number of updating threads
+ * @param GLOBAL Serialise every call through one mutex instead of relying on the per-entry locks
+ * @return Result Measured throughput
+ */
+static Result run(const Options &OPTIONS, unsigned THREADS, bool GLOBAL)
+{
+  unsigned entries = OPTIONS.SHARED ? OPTIONS.ENTRIES : OPTIONS.ENTRIES * THREADS;
+  std::vector<uint8_t> erased((ENTRY_OVERHEAD + OPTIONS.LENGTH) * entries * 8 + 4096, 0xFF);
+  SharedImage image(erased);
+  std::vector<SharedImage::Slot*> slots;
+  for (unsigned i = 0; i < entries; i++)
+  {
+    slots.push_back(image.attach(i, OPTIONS.LENGTH));
+  }
+  std::mutex global;
+  std::atomic<bool> stop(false);
+  std::vector<uint64_t> updates(THREADS, 0);
+  std::vector<uint64_t> writes(THREADS, 0);
+  std::vector<std::thread> threads;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < THREADS; t++)
+  {
+    threads.push_back(std::thread([&, t]()
+    {
+      std::vector<uint8_t> data(OPTIONS.ENTRIES * OPTIONS.LENGTH, 0);
+      uint32_t random = 2463534242UL + t;
+      uint64_t count = 0;
+      uint64_t written = 0;
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        // xorshift32 picks the entry and whether this call changes it
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        unsigned index = (random >> 8) % OPTIONS.ENTRIES;
+        SharedImage::Slot *slot = slots[OPTIONS.SHARED ? index : t * OPTIONS.ENTRIES + index];
+        uint8_t *entryData = &data[index * OPTIONS.LENGTH];
+        if (random % 100 < OPTIONS.CHANGED)
+        {
+          entryData[0]++;
+        }
+        uint32_t writeCount;
+        if (GLOBAL)
+        {
+          std::lock_guard<std::mutex> lock(global);
+          writeCount = slot->update(entryData);
+        }
+        else
+        {
+          writeCount = slot->update(entryData);
+        }
+        written += writeCount != 0;
+        count++;
+      }
+      updates[t] = count;
+      writes[t] = written;
+    }));
+  }
+  std::thread committer([&]()
+  {
+    std::vector<uint8_t> copy;
+    while (!stop.load())
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(OPTIONS.COMMIT_MS));
+      if (GLOBAL)
+      {
+        std::lock_guard<std::mutex> lock(global);
+        image.commit(copy);
+      }
+      else
+      {
+        image.commit(copy);
+      }
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::duration<double>(OPTIONS.SECONDS));
+  stop = true;
+  for (size_t t = 0; t < threads.size(); t++)
+  {
+    threads[t].join();
+  }
+  committer.join();
+  Result result = {0, 0, image.commits(), std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+  for (unsigned t = 0; t < THREADS; t++)
+  {
+    result.UPDATES += updates[t];
+    result.WRITES += writes[t];
+  }
+  return result;
+}
+
+int main(int argc, char **argv)
+{
+  Options options;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc) options.THREADS = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--entries") && i + 1 < argc) options.ENTRIES = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--length") && i + 1 < argc) options.LENGTH = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--changed") && i + 1 < argc) options.CHANGED = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) options.SECONDS = strtod(argv[++i], NULL);
+    else if (!strcmp(argv[i], "--commit-ms") && i + 1 < argc) options.COMMIT_MS = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--shared")) options.SHARED = true;
+    else if (!strcmp(argv[i], "--global")) options.GLOBAL = true;
+    else
+    {
+      fprintf(stderr, "Usage: %s [-t THREADS] [--entries COUNT] [--length BYTES] [--changed PERCENT] [--seconds S]\n"
+        "          [--commit-ms MS] [--shared] [--global]\n", argv[0]);
+      return 1;
+    }
+  }
+  options.THREADS = options.THREADS ? options.THREADS : 1;
+  options.ENTRIES = options.ENTRIES ? options.ENTRIES : 1;
+  options.COMMIT_MS = options.COMMIT_MS ? options.COMMIT_MS : 1;
+
+  printf("%u %s entries of %u bytes, %u%% changed, %.1f s per run, commit every %u ms\n",
+    options.SHARED ? options.ENTRIES : options.ENTRIES * options.THREADS, options.SHARED ? "shared" : "private",
+    options.LENGTH, options.CHANGED, options.SECONDS, options.COMMIT_MS);
+  printf("%-8s %-8s %14s %14s %10s %8s\n", "locking", "threads", "updates/s", "writes/s", "commits", "speedup");
+  for (int mode = 0; mode < (options.GLOBAL ? 2 : 1); mode++)
+  {
+    double single = 0;
+    for (unsigned threads = 1; threads <= options.THREADS; threads++)
+    {
+      Result result = run(options, threads, mode == 1);
+      double rate = result.UPDATES / result.SECONDS;
+      single = threads == 1 ? rate : single;
+      printf("%-8s %-8u %14.0f %14.0f %10u %7.2fx\n", mode ? "global" : "entry", threads, rate,
+        result.WRITES / result.SECONDS, result.COMMITS, single ? rate / single : 0);
+    }
+  }
+  return 0;
+}
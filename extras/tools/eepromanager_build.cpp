@@ -0,0 +1,257 @@
+/**
+ * @file eepromanager_build.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Builds a complete EEPROM image for factory provisioning
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Lays out EEPROM ENTRIES exactly as the EEPROManager constructors would write them on first boot, so the
+ * image can be flashed in one transfer and the board boots straight into reading its settings. Entries must be listed
+ * in the order the EEPROManager objects are constructed and their data must match the memory layout of the struct,
+ * including padding.
+ * 
+ * Description file, one directive per line ('#' starts a comment):
+ *   size BYTES              EEPROM size (default 1024)
+ *   key KEY [LENGTH]        Starts an entry, LENGTH (sizeof the struct) zero pads the data and checks it fits
+ *   u8|u16|u32 VALUE        Unsigned little endian integer
+ *   i8|i16|i32 VALUE        Signed little endian integer
+ *   f32 VALUE               IEEE 754 float
+ *   str SIZE "TEXT"         Fixed size character array, zero padded
+ *   hex BYTE...             Raw bytes in hexadecimal
+ *   pad COUNT               COUNT zero bytes (struct padding)
+ * 
+ * Build: g++ -std=c++11 -O2 -o eepromanager_build eepromanager_build.cpp
+ * Usage: eepromanager_build DESCRIPTION -o IMAGE [--ihex]
+ *   --ihex writes Intel HEX (e.g. the .eep format used by avrdude) instead of a raw binary image.
+ */
+
+#include "EEPROManagerHost.h"
+
+#include <stdlib.h>
+#include <string>
+
+using namespace EEPROManagerHost;
+
+/**
+ * @brief Entry collected from the description
+ * 
+ */
+struct Description
+{
+  uint16_t KEY;
+  uint32_t LENGTH;                                      // Declared LENGTH, 0 when not declared
+  std::vector<uint8_t> DATA;
+};
+
+/**
+ * @brief Reports a description error and exits
+ * 
+ */
+static void fail(const char *PATH, unsigned LINE, const char *MESSAGE)
+{
+  fprintf(stderr, "%s:%u: %s\n", PATH, LINE, MESSAGE);
+  exit(1);
+}
+
+/**
+ * @brief Closes the current entry, applying its declared LENGTH
+ * 
+ */
+static void finish(const char *PATH, unsigned LINE, std::vector<Description> &ENTRIES)
+{
+  if (ENTRIES.empty())
+  {
+    return;
+  }
+  Description &entry = ENTRIES.back();
+  if (entry.LENGTH)
+  {
+    if (entry.DATA.size() > entry.LENGTH)
+    {
+      fail(PATH, LINE, "entry data is longer than its declared LENGTH");
+    }
+    entry.DATA.resize(entry.LENGTH, 0);
+  }
+  if (entry.DATA.size() > 0xFFFF)
+  {
+    fail(PATH, LINE, "entry data is longer than 65535 bytes");
+  }
+}
+
+/**
+ * @brief Writes an image as Intel HEX records
+ * 
+ */
+static void writeIntelHex(FILE *OUTPUT, const std::vector<uint8_t> &IMAGE)
+{
+  for (size_t address = 0; address < IMAGE.size(); address += 16)
+  {
+    uint8_t count = IMAGE.size() - address < 16 ? IMAGE.size() - address : 16;
+    uint8_t checksum = count + (address >> 8) + address;
+    fprintf(OUTPUT, ":%02X%04X00", count, static_cast<unsigned>(address & 0xFFFF));
+    for (uint8_t i = 0; i < count; i++)
+    {
+      fprintf(OUTPUT, "%02X", IMAGE[address + i]);
+      checksum += IMAGE[address + i];
+    }
+    fprintf(OUTPUT, "%02X\n", static_cast<uint8_t>(-checksum));
+  }
+  fprintf(OUTPUT, ":00000001FF\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *descriptionPath = NULL;
+  const char *imagePath = NULL;
+  bool intelHex = false;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) imagePath = argv[++i];
+    else if (!strcmp(argv[i], "--ihex")) intelHex = true;
+    else descriptionPath = argv[i];
+  }
+  if (!descriptionPath || !imagePath)
+  {
+    fprintf(stderr, "Usage: %s DESCRIPTION -o IMAGE [--ihex]\n", argv[0]);
+    return 1;
+  }
+  FILE *description = fopen(descriptionPath, "r");
+  if (!description)
+  {
+    fprintf(stderr, "%s: cannot read %s\n", argv[0], descriptionPath);
+    return 1;
+  }
+
+  // Parse the description
+  uint32_t size = 1024;
+  std::vector<Description> entries;
+  char line[1024];
+  unsigned lineNumber = 0;
+  while (fgets(line, sizeof(line), description))
+  {
+    lineNumber++;
+    char *comment = strchr(line, '#');
+    if (comment && !strchr(line, '"'))
+    {
+      *comment = 0;
+    }
+    char directive[16];
+    int consumed = 0;
+    if (sscanf(line, " %15s %n", directive, &consumed) != 1)
+    {
+      continue;
+    }
+    const char *arguments = line + consumed;
+    std::string name(directive);
+    if (name == "size")
+    {
+      size = strtoul(arguments, NULL, 0);
+      continue;
+    }
+    if (name == "key")
+    {
+      finish(descriptionPath, lineNumber, entries);
+      char *end;
+      Description entry;
+      entry.KEY = strtoul(arguments, &end, 0);
+      entry.LENGTH = strtoul(end, NULL, 0);
+      for (size_t i = 0; i < entries.size(); i++)
+      {
+        if (entries[i].KEY == entry.KEY)
+        {
+          fail(descriptionPath, lineNumber, "duplicate KEY");
+        }
+      }
+      entries.push_back(entry);
+      continue;
+    }
+    if (entries.empty())
+    {
+      fail(descriptionPath, lineNumber, "data before the first key directive");
+    }
+    std::vector<uint8_t> &data = entries.back().DATA;
+    uint8_t bytes[4];
+    if (name == "u8" || name == "i8" || name == "u16" || name == "i16" || name == "u32" || name == "i32")
+    {
+      uint32_t value = name[0] == 'u' ? strtoul(arguments, NULL, 0) : static_cast<uint32_t>(strtol(arguments, NULL, 0));
+      size_t width = name == "u8" || name == "i8" ? 1 : name == "u16" || name == "i16" ? 2 : 4;
+      put32(bytes, value);
+      data.insert(data.end(), bytes, bytes + width);
+    }
+    else if (name == "f32")
+    {
+      float value = strtof(arguments, NULL);
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      put32(bytes, bits);
+      data.insert(data.end(), bytes, bytes + 4);
+    }
+    else if (name == "str")
+    {
+      char *end;
+      size_t capacity = strtoul(arguments, &end, 0);
+      const char *open = strchr(end, '"');
+      const char *close = open ? strrchr(open + 1, '"') : NULL;
+      if (!close || static_cast<size_t>(close - open - 1) > capacity)
+      {
+        fail(descriptionPath, lineNumber, "expected str SIZE \"TEXT\" with TEXT no longer than SIZE");
+      }
+      size_t start = data.size();
+      data.resize(start + capacity, 0);
+      memcpy(&data[start], open + 1, close - open - 1);
+    }
+    else if (name == "hex")
+    {
+      char *end;
+      for (unsigned long value = strtoul(arguments, &end, 16); end != arguments; value = strtoul(arguments, &end, 16))
+      {
+        data.push_back(value);
+        arguments = end;
+      }
+    }
+    else if (name == "pad")
+    {
+      data.resize(data.size() + strtoul(arguments, NULL, 0), 0);
+    }
+    else
+    {
+      fail(descriptionPath, lineNumber, "unknown directive");
+    }
+  }
+  fclose(description);
+  finish(descriptionPath, lineNumber, entries);
+
+  // Lay the entries out in construction order, followed by erased space
+  std::vector<uint8_t> image;
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    append(image, entries[i].KEY, entries[i].DATA.data(), entries[i].DATA.size());
+  }
+  if (image.size() > size)
+  {
+    fprintf(stderr, "%s: entries need %zu bytes but the EEPROM holds %u\n", argv[0], image.size(), size);
+    return 1;
+  }
+  uint32_t used = image.size();
+  image.resize(size, 0xFF);
+
+  FILE *output = fopen(imagePath, intelHex ? "w" : "wb");
+  if (!output)
+  {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], imagePath);
+    return 1;
+  }
+  if (intelHex)
+  {
+    writeIntelHex(output, image);
+  }
+  else
+  {
+    fwrite(image.data(), 1, image.size(), output);
+  }
+  fclose(output);
+  printf("%s: %zu entries, %u of %u bytes used\n", imagePath, entries.size(), used, size);
+  return 0;
+}
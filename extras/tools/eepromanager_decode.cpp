@@ -0,0 +1,78 @@
+/**
+ * @file eepromanager_decode.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Rebuilds EEPROM images from EEPROManager::dump() captures
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Decodes the CRC protected frames sent by EEPROManager::dump(), writes every rebuilt image to
+ * PREFIX<n>.bin and lists the EEPROM ENTRY headers found in it.
+ * 
+ * Build: g++ -std=c++11 -O2 -o eepromanager_decode eepromanager_decode.cpp
+ * Usage: eepromanager_decode [-o PREFIX] CAPTURE...
+ */
+
+#include "EEPROManagerHost.h"
+
+using namespace EEPROManagerHost;
+
+int main(int argc, char **argv)
+{
+  const char *prefix = "image";
+  std::vector<Dump> dumps;
+  bool captures = false;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc)
+    {
+      prefix = argv[++i];
+      continue;
+    }
+    std::vector<uint8_t> capture;
+    if (!load(argv[i], capture))
+    {
+      fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[i]);
+      return 1;
+    }
+    decode(capture, dumps);
+    captures = true;
+  }
+  if (!captures)
+  {
+    fprintf(stderr, "Usage: %s [-o PREFIX] CAPTURE...\n", argv[0]);
+    return 1;
+  }
+
+  int result = 0;
+  for (size_t n = 0; n < dumps.size(); n++)
+  {
+    const Dump &dump = dumps[n];
+    char path[256];
+    snprintf(path, sizeof(path), "%s%zu.bin", prefix, n);
+    FILE *file = fopen(path, "wb");
+    if (!file || fwrite(dump.IMAGE.data(), 1, dump.IMAGE.size(), file) != dump.IMAGE.size())
+    {
+      fprintf(stderr, "%s: cannot write %s\n", argv[0], path);
+      return 1;
+    }
+    fclose(file);
+    printf("%s: %zu bytes, %u frames, %u corrupt%s%s\n", path, dump.IMAGE.size(), dump.FRAMES, dump.CORRUPT,
+      dump.LIVE_ONLY ? ", live entries only" : "", dump.COMPLETE ? "" : ", INCOMPLETE");
+    std::vector<Entry> entries;
+    uint32_t end = parse(dump.IMAGE.data(), dump.IMAGE.size(), entries);
+    for (size_t e = 0; e < entries.size(); e++)
+    {
+      const Entry &entry = entries[e];
+      printf("  @%04X KEY %04X LENGTH %5u WRITE_COUNT %6u %s\n", entry.ADDRESS, entry.KEY, entry.LENGTH, entry.WRITE_COUNT,
+        entry.TRUNCATED ? "TRUNCATED" : entry.RETIRED ? "retired" : entry.VALID ? "ok" : "CRC32 MISMATCH");
+    }
+    printf("  %u bytes free\n", static_cast<uint32_t>(dump.IMAGE.size()) - end);
+    if (!dump.COMPLETE)
+    {
+      result = 2;
+    }
+  }
+  return result;
+}
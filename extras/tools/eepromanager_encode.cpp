@@ -0,0 +1,117 @@
+/**
+ * @file eepromanager_encode.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Encodes an EEPROM image as frames for EEPROManager::import()
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details By default the whole image is sent (HEADER, DATA/FILL, END) and replaces the board's EEPROM. With --entries
+ * only the data of the live EEPROM ENTRIES is sent as ENTRY frames, patching the matching entries on the board
+ * wherever they are located. Write the output straight to the serial port of a board waiting in import().
+ * 
+ * Build: g++ -std=c++11 -O2 -o eepromanager_encode eepromanager_encode.cpp
+ * Usage: eepromanager_encode IMAGE -o FRAMES [--entries] [--chunk BYTES]
+ */
+
+#include "EEPROManagerHost.h"
+
+#include <stdlib.h>
+
+using namespace EEPROManagerHost;
+
+int main(int argc, char **argv)
+{
+  const char *imagePath = NULL;
+  const char *framesPath = NULL;
+  bool entriesOnly = false;
+  uint32_t chunk = 64;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) framesPath = argv[++i];
+    else if (!strcmp(argv[i], "--entries")) entriesOnly = true;
+    else if (!strcmp(argv[i], "--chunk") && i + 1 < argc) chunk = strtoul(argv[++i], NULL, 0);
+    else imagePath = argv[i];
+  }
+  std::vector<uint8_t> image;
+  if (!imagePath || !framesPath || chunk < 4 || chunk > 255)
+  {
+    fprintf(stderr, "Usage: %s IMAGE -o FRAMES [--entries] [--chunk BYTES (4-255, default 64)]\n", argv[0]);
+    return 1;
+  }
+  if (!load(imagePath, image) || image.size() > 0xFFFF)
+  {
+    fprintf(stderr, "%s: cannot read %s or it is larger than 64 KiB\n", argv[0], imagePath);
+    return 1;
+  }
+
+  std::vector<uint8_t> stream;
+  uint16_t frames = 0;
+  if (entriesOnly)
+  {
+    std::vector<Entry> entries;
+    parse(image.data(), image.size(), entries);
+    for (size_t e = 0; e < entries.size(); e++)
+    {
+      const Entry &entry = entries[e];
+      if (entry.RETIRED || entry.TRUNCATED)
+      {
+        continue;
+      }
+      for (uint32_t offset = 0; offset < entry.LENGTH; offset += chunk - 2)
+      {
+        uint8_t payload[255];
+        uint32_t length = entry.LENGTH - offset < chunk - 2 ? entry.LENGTH - offset : chunk - 2;
+        put16(payload, offset);
+        memcpy(payload + 2, &image[entry.ADDRESS + HEADER_SIZE + offset], length);
+        frame(stream, 'E', entry.KEY, payload, length + 2);
+        frames++;
+      }
+    }
+  }
+  else
+  {
+    uint8_t header[3];
+    put16(header, image.size());
+    header[2] = 0;
+    frame(stream, 'H', 0, header, sizeof(header));
+    frames++;
+    for (uint32_t address = 0; address < image.size();)
+    {
+      uint32_t run = 0;
+      while (address + run < image.size() && image[address + run] == 0xFF)
+      {
+        run++;
+      }
+      if (run >= chunk || address + run == image.size())
+      {
+        uint8_t fill[3];
+        put16(fill, run);
+        fill[2] = 0xFF;
+        frame(stream, 'F', address, fill, sizeof(fill));
+        address += run;
+      }
+      else
+      {
+        uint32_t length = image.size() - address < chunk ? image.size() - address : chunk;
+        frame(stream, 'D', address, &image[address], length);
+        address += length;
+      }
+      frames++;
+    }
+  }
+  uint8_t trailer[2];
+  put16(trailer, ++frames);
+  frame(stream, 'Z', 0, trailer, sizeof(trailer));
+
+  FILE *output = fopen(framesPath, "wb");
+  if (!output || fwrite(stream.data(), 1, stream.size(), output) != stream.size())
+  {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], framesPath);
+    return 1;
+  }
+  fclose(output);
+  printf("%s: %u frames, %zu bytes\n", framesPath, frames, stream.size());
+  return 0;
+}
@@ -0,0 +1,277 @@
+/**
+ * @file eepromanager_replay.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Replays an EEPROManager write trace against an emulated EEPROM
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Reads the framed records produced by EEPROManagerTrace::stream() (raw serial captures may contain other
+ * output, frames are resynchronised on their CRC8) and replays the changed updates against an emulated EEPROM using
+ * the EEPROManager layout and relocation rules. The storage policy is selected on the command line so write-back and
+ * wear settings can be compared against a production workload.
+ * 
+ * Build: g++ -std=c++11 -O2 -o eepromanager_replay eepromanager_replay.cpp
+ * Usage: eepromanager_replay [--size BYTES] [--max-writes COUNT] [--write-back MS] TRACE...
+ */
+
+#include "EEPROManagerHost.h"
+
+#include <stdlib.h>
+#include <map>
+
+using namespace EEPROManagerHost;
+
+/**
+ * @brief Record decoded from a trace frame
+ * 
+ */
+struct TraceRecord
+{
+  uint64_t TIME;                                        // Unwrapped micros since the first record
+  uint16_t KEY;
+  uint16_t LENGTH;
+  uint16_t CHANGED;
+  uint32_t WRITE_COUNT;
+  uint32_t LATENCY;
+};
+
+/**
+ * @brief Emulated EEPROM applying the EEPROManager allocation and relocation rules
+ * 
+ */
+class Emulator
+{
+  public:
+    Emulator(uint32_t SIZE, uint32_t MAX_WRITES) : _WEAR(SIZE, 0), _SIZE(SIZE), _MAX_WRITES(MAX_WRITES) {}
+
+    /**
+     * @brief Writes an EEPROM ENTRY, allocating or relocating it as EEPROManager would
+     * 
+     * @param KEY Unique KEY of the EEPROM ENTRY
+     * @param LENGTH LENGTH of the EEPROM ENTRY data
+     * @return true The entry was written
+     * @return false No space was left in the EEPROM
+     */
+    bool write(uint16_t KEY, uint16_t LENGTH)
+    {
+      std::map<uint16_t, Slot>::iterator slot = _SLOTS.find(KEY);
+      if (slot == _SLOTS.end())
+      {
+        if (!allocate(KEY, LENGTH))
+        {
+          return false;
+        }
+        wear(_SLOTS[KEY].ADDRESS, ENTRY_OVERHEAD + LENGTH);
+        return true;
+      }
+      Slot &entry = slot->second;
+      entry.WRITE_COUNT++;
+      wear(entry.ADDRESS + 3, 4);
+      wear(entry.ADDRESS + HEADER_SIZE, LENGTH + 4);
+      if (entry.WRITE_COUNT >= _MAX_WRITES)
+      {
+        RELOCATIONS++;
+        _SLOTS.erase(slot);
+        if (!allocate(KEY, LENGTH))
+        {
+          return false;
+        }
+        wear(_SLOTS[KEY].ADDRESS, ENTRY_OVERHEAD + LENGTH);
+      }
+      return true;
+    }
+
+    /**
+     * @brief Returns the highest write count of any single byte
+     * 
+     */
+    uint32_t maximumWear() const
+    {
+      uint32_t maximum = 0;
+      for (size_t i = 0; i < _WEAR.size(); i++)
+      {
+        if (_WEAR[i] > maximum) maximum = _WEAR[i];
+      }
+      return maximum;
+    }
+
+    uint32_t freeSpace() const { return _SIZE - _END; }
+
+    uint32_t RELOCATIONS = 0;                           // Entries moved after reaching the maximum write count
+
+  private:
+    struct Slot
+    {
+      uint32_t ADDRESS;
+      uint32_t WRITE_COUNT;
+    };
+
+    bool allocate(uint16_t KEY, uint16_t LENGTH)
+    {
+      if (_END + ENTRY_OVERHEAD + LENGTH > _SIZE)
+      {
+        return false;
+      }
+      Slot entry = {_END, 1};
+      _SLOTS[KEY] = entry;
+      _END += ENTRY_OVERHEAD + LENGTH;
+      return true;
+    }
+
+    void wear(uint32_t ADDRESS, uint32_t LENGTH)
+    {
+      for (uint32_t i = ADDRESS; i < ADDRESS + LENGTH && i < _SIZE; i++)
+      {
+        _WEAR[i]++;
+      }
+    }
+
+    std::map<uint16_t, Slot> _SLOTS;                    // Live EEPROM ENTRY per KEY
+    std::vector<uint32_t> _WEAR;                        // Write count of every byte
+    uint32_t _SIZE;                                     // EEPROM size in bytes
+    uint32_t _MAX_WRITES;                               // WRITE_COUNT at which entries are relocated
+    uint32_t _END = 0;                                  // First byte of uninitialised space
+};
+
+/**
+ * @brief Extracts trace records from a capture, skipping anything which is not a valid frame
+ * 
+ * @param CAPTURE Raw capture
+ * @param RECORDS Receives the decoded records
+ * @param TIME Unwrapped time of the last record, carried across captures
+ * @param LAST Raw micros() of the last record, carried across captures
+ */
+static void decode(const std::vector<uint8_t> &CAPTURE, std::vector<TraceRecord> &RECORDS, uint64_t &TIME, uint32_t &LAST)
+{
+  size_t i = 0;
+  while (i + 20 <= CAPTURE.size())
+  {
+    const uint8_t *frame = &CAPTURE[i];
+    if (frame[0] != 0xA5 || crc8(frame + 1, 18) != frame[19])
+    {
+      i++;
+      continue;
+    }
+    uint32_t micros = get32(frame + 1);
+    if (!RECORDS.empty())
+    {
+      TIME += static_cast<uint32_t>(micros - LAST);
+    }
+    LAST = micros;
+    TraceRecord record = {TIME, get16(frame + 5), get16(frame + 7), get16(frame + 9), get32(frame + 11), get32(frame + 15)};
+    RECORDS.push_back(record);
+    i += 20;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t size = 1024;
+  uint32_t maxWrites = EEPROM_MAX_WRITES;
+  uint64_t writeBack = 0;
+  std::vector<TraceRecord> records;
+  uint64_t time = 0;
+  uint32_t last = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--size") && i + 1 < argc) size = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--max-writes") && i + 1 < argc) maxWrites = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--write-back") && i + 1 < argc) writeBack = strtoull(argv[++i], NULL, 0) * 1000;
+    else
+    {
+      std::vector<uint8_t> capture;
+      if (!load(argv[i], capture))
+      {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[i]);
+        return 1;
+      }
+      decode(capture, records, time, last);
+    }
+  }
+  if (records.empty())
+  {
+    fprintf(stderr, "Usage: %s [--size BYTES] [--max-writes COUNT] [--write-back MS] TRACE...\n", argv[0]);
+    return 1;
+  }
+
+  // Replay: changed updates are written immediately, or after WRITE_BACK micros without further changes
+  Emulator eeprom(size, maxWrites);
+  std::map<uint16_t, TraceRecord> pending;
+  std::map<uint16_t, uint32_t> writesPerKey;
+  std::map<uint16_t, uint16_t> lengthPerKey;
+  uint32_t changes = 0;
+  uint64_t latency = 0;
+  uint32_t maximumLatency = 0;
+  bool full = false;
+  for (size_t i = 0; i <= records.size() && !full; i++)
+  {
+    uint64_t now = i < records.size() ? records[i].TIME : UINT64_MAX;
+    for (std::map<uint16_t, TraceRecord>::iterator due = pending.begin(); due != pending.end();)
+    {
+      if (due->second.TIME + writeBack <= now)
+      {
+        full = full || !eeprom.write(due->first, due->second.LENGTH);
+        writesPerKey[due->first]++;
+        pending.erase(due++);
+      }
+      else
+      {
+        ++due;
+      }
+    }
+    if (i == records.size())
+    {
+      break;
+    }
+    const TraceRecord &record = records[i];
+    latency += record.LATENCY;
+    if (record.LATENCY > maximumLatency) maximumLatency = record.LATENCY;
+    lengthPerKey[record.KEY] = record.LENGTH;
+    if (record.WRITE_COUNT == 0)
+    {
+      continue;
+    }
+    changes++;
+    if (writeBack == 0)
+    {
+      full = !eeprom.write(record.KEY, record.LENGTH);
+      writesPerKey[record.KEY]++;
+    }
+    else
+    {
+      pending[record.KEY] = record;
+    }
+  }
+
+  double seconds = records.back().TIME / 1e6;
+  printf("records          %zu over %.1f s\n", records.size(), seconds);
+  printf("update latency   mean %.1f us, max %u us\n", static_cast<double>(latency) / records.size(), maximumLatency);
+  printf("changed updates  %u\n", changes);
+  uint32_t writes = 0;
+  for (std::map<uint16_t, uint32_t>::iterator key = writesPerKey.begin(); key != writesPerKey.end(); ++key)
+  {
+    writes += key->second;
+  }
+  printf("entry writes     %u (%u avoided)\n", writes, changes - writes);
+  printf("relocations      %u\n", eeprom.RELOCATIONS);
+  printf("maximum wear     %u writes on a single byte\n", eeprom.maximumWear());
+  printf("free space       %u bytes%s\n", eeprom.freeSpace(), full ? " (EEPROM FULL)" : "");
+
+  // Every MAX_WRITES writes of an entry consume another ENTRY_OVERHEAD + LENGTH bytes of free space
+  double consumption = 0;
+  for (std::map<uint16_t, uint32_t>::iterator key = writesPerKey.begin(); key != writesPerKey.end(); ++key)
+  {
+    printf("  KEY %04X       %u writes\n", key->first, key->second);
+    if (seconds > 0)
+    {
+      consumption += (ENTRY_OVERHEAD + lengthPerKey[key->first]) * (key->second / seconds) / maxWrites;
+    }
+  }
+  if (consumption > 0)
+  {
+    printf("projected life   %.1f days until the EEPROM is exhausted\n", eeprom.freeSpace() / consumption / 86400.0);
+  }
+  return full ? 2 : 0;
+}
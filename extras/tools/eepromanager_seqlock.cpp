@@ -0,0 +1,174 @@
+/**
+ * @file eepromanager_seqlock.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Stress tests EEPROManagerSeqLock: no torn MEMORY image is ever persisted
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @details Runs the EEPROManager library itself against a RAM backed EEPROM. A writer thread keeps modifying MEMORY
+ * field by field inside beginWrite() / endWrite(), every field derived from a generation number, while an updater
+ * thread calls update() in a loop. After every write the updater reads the EEPROM ENTRY back and checks that:
+ *  -# the stored CRC32 matches the CRC32 of the stored data
+ *  -# the stored data is one complete generation, i.e. a value the writer actually produced
+ *  -# that generation is not newer than the writer has reached
+ * The writer spins --gap iterations between modifications. With --unlocked it skips the sequence lock, which shows the
+ * check catches torn images.
+ * 
+ * Build: g++ -std=c++11 -O2 -pthread -Iarduino -I../../src -o eepromanager_seqlock eepromanager_seqlock.cpp
+ * Usage: eepromanager_seqlock [--seconds S] [--gap SPINS] [--unlocked]
+ * Exit status is 2 when a torn or corrupt image was persisted under the sequence lock.
+ */
+
+#define EEPROMANAGER_HOST_EEPROM_SIZE 65535
+
+#include <EEPROManager.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <thread>
+
+/**
+ * @brief MEMORY of the test, large enough that copying it takes many instructions
+ * 
+ */
+struct Sample
+{
+  uint32_t GENERATION;                                  // Generation every other field is derived from
+  uint32_t WORDS[31];                                   // Derived from GENERATION and the word index
+};
+
+static Sample sample;
+static EEPROManagerSeqLock lock;
+static EEPROManager<Sample> manager(&sample, 0x0001);
+
+/**
+ * @brief Returns the value of a word of a generation
+ * 
+ */
+static uint32_t derive(uint32_t GENERATION, uint32_t INDEX)
+{
+  uint32_t value = GENERATION * 2654435761UL + INDEX * 40503UL;
+  return value ^ (value >> 15);
+}
+
+/**
+ * @brief Returns true if DATA is one complete generation
+ * 
+ */
+static bool complete(const Sample &DATA)
+{
+  for (uint32_t i = 0; i < 31; i++)
+  {
+    if (DATA.WORDS[i] != derive(DATA.GENERATION, i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = 2;
+  unsigned gap = 200;
+  bool locked = true;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = strtod(argv[++i], NULL);
+    else if (!strcmp(argv[i], "--gap") && i + 1 < argc) gap = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--unlocked")) locked = false;
+    else
+    {
+      fprintf(stderr, "Usage: %s [--seconds S] [--gap SPINS] [--unlocked]\n", argv[0]);
+      return 1;
+    }
+  }
+  for (uint32_t i = 0; i < 31; i++)
+  {
+    sample.WORDS[i] = derive(0, i);
+  }
+  manager.reload();
+  manager.seqlock(&lock);
+
+  std::atomic<bool> stop(false);
+  std::atomic<uint32_t> produced(0);
+  std::thread writer([&]()
+  {
+    for (uint32_t generation = 1; !stop.load(std::memory_order_relaxed); generation++)
+    {
+      if (locked)
+      {
+        lock.beginWrite();
+      }
+      // Field by field, the way a sketch changes settings, so an unguarded copy can catch it half way
+      for (uint32_t i = 0; i < 31; i++)
+      {
+        reinterpret_cast<volatile uint32_t*>(sample.WORDS)[i] = derive(generation, i);
+      }
+      reinterpret_cast<volatile uint32_t&>(sample.GENERATION) = generation;
+      if (locked)
+      {
+        lock.endWrite();
+      }
+      produced.store(generation, std::memory_order_release);
+      // A short gap between modifications, as a real writer has, lets snapshots succeed within their retries
+      for (volatile unsigned spin = 0; spin < gap; spin++)
+      {
+      }
+    }
+  });
+
+  uint64_t updates = 0;
+  uint64_t writes = 0;
+  uint64_t corrupt = 0;
+  uint64_t torn = 0;
+  uint64_t future = 0;
+  uint32_t full = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds)
+  {
+    uint32_t writeCount = manager.update();
+    updates++;
+    if (writeCount == 0xFFFFFFFF)
+    {
+      full++;
+      break;
+    }
+    if (!writeCount)
+    {
+      continue;
+    }
+    writes++;
+    // Produced is read after the write, so a persisted generation can never legitimately exceed it
+    uint32_t reached = produced.load(std::memory_order_acquire) + 1;
+    uint16_t length = 0;
+    uint16_t address = EEPROManagerBase::find(0x0001, length);
+    Sample stored;
+    uint32_t storedCRC32 = 0;
+    EEPROM.get(address + 9, stored);
+    EEPROM.get(address + 9 + sizeof(Sample), storedCRC32);
+    if (length != sizeof(Sample) || crc32(reinterpret_cast<const uint8_t*>(&stored), sizeof(Sample)) != storedCRC32)
+    {
+      corrupt++;
+    }
+    else if (!complete(stored))
+    {
+      torn++;
+    }
+    else if (stored.GENERATION > reached)
+    {
+      future++;
+    }
+  }
+  stop = true;
+  writer.join();
+
+  printf("%s writer: %llu update() calls, %llu writes over %u generations\n", locked ? "locked" : "unlocked",
+    static_cast<unsigned long long>(updates), static_cast<unsigned long long>(writes), produced.load());
+  printf("%llu CRC32 mismatches, %llu torn images, %llu unproduced generations%s\n",
+    static_cast<unsigned long long>(corrupt), static_cast<unsigned long long>(torn), static_cast<unsigned long long>(future),
+    full ? ", stopped early: EEPROM full" : "");
+  bool failed = corrupt || torn || future;
+  printf("%s\n", failed ? "FAILED" : "ok");
+  return locked && failed ? 2 : 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file eepromanager_store.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Checks that EEPROManagerStore cannot damage other EEPROM ENTRIES and never returns a torn value
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @details Runs the EEPROManager library itself against a RAM backed EEPROM and checks that:
+ *  -# put() refuses EEPROMANAGER_JOURNAL_KEY, so a value shaped like a sealed journal cannot make
+ *     EEPROManagerTransaction::recover() overwrite an EEPROManager
+ *  -# put() and remove() refuse the KEY of a constructed EEPROManager and leave its EEPROM ENTRY untouched
+ *  -# get() reports a value whose in-place rewrite was interrupted (data written, CRC32 not) as missing
+ * 
+ * Build: g++ -std=c++11 -O2 -Iarduino -I../../src -o eepromanager_store eepromanager_store.cpp
+ * Usage: eepromanager_store
+ * Exit status is 2 when a check fails.
+ */
+
+#include <EEPROManager.h>
+
+static uint32_t settings = 0x11223344;
+static EEPROManager<uint32_t> manager(&settings, 0x0001);
+
+static uint8_t failures = 0;
+
+/**
+ * @brief Prints the outcome of a check and counts failures
+ * 
+ */
+static void check(const char *NAME, bool PASSED)
+{
+  printf("%-60s %s\n", NAME, PASSED ? "ok" : "FAILED");
+  failures += !PASSED;
+}
+
+/**
+ * @brief Returns the value in the EEPROM ENTRY of the manager
+ * 
+ */
+static uint32_t stored()
+{
+  uint16_t length = 0;
+  uint16_t address = EEPROManagerBase::find(0x0001, length);
+  uint32_t value = 0;
+  EEPROM.get(address + 9, value);
+  return value;
+}
+
+int main()
+{
+  manager.update();
+  EEPROManagerStore store;
+  store.begin();
+
+  // Journal data: STATE 1, one record for KEY 0x0001 at ADDRESS 0 with WRITE_COUNT 5 and 4 bytes of data
+  const uint8_t journal[] = {1, 1, 0x01, 0x00, 0x00, 0x00, 5, 0, 0, 0, 4, 0, 0xEF, 0xBE, 0xAD, 0xDE};
+  check("put(EEPROMANAGER_JOURNAL_KEY) is refused", store.put(EEPROMANAGER_JOURNAL_KEY, journal, sizeof(journal)) == 0xFFFFFFFF);
+  check("put(0xFFFF) is refused", store.put(0xFFFF, journal, sizeof(journal)) == 0xFFFFFFFF);
+  check("recover() finds no journal", !EEPROManagerTransaction::recover());
+  check("EEPROManager MEMORY and EEPROM ENTRY are untouched", settings == 0x11223344 && stored() == 0x11223344);
+
+  uint32_t other = 0xDEADBEEF;
+  check("put() of an EEPROManager KEY is refused", store.put(0x0001, &other, sizeof(other)) == 0xFFFFFFFF);
+  check("remove() of an EEPROManager KEY is refused", !store.remove(0x0001));
+  uint16_t length = 0;
+  check("EEPROManager EEPROM ENTRY is still live and unchanged", EEPROManagerBase::find(0x0001, length) != 0xFFFF && stored() == 0x11223344);
+  check("EEPROManager sees no change", !manager.changed());
+
+  const char before[] = "before";
+  const char after[] = "after!";
+  char buffer[8] = {0};
+  store.put(0x0100, before, sizeof(before));
+  uint16_t address = EEPROManagerBase::find(0x0100, length);
+  // Reset half way through an in-place put(): the data is rewritten but the CRC32 is not
+  for (uint8_t i = 0; i < sizeof(after); i++)
+  {
+    EEPROM.write(address + 9 + i, after[i]);
+  }
+  check("get() of an interrupted in-place put() returns 0", store.get(0x0100, buffer, sizeof(buffer)) == 0);
+  check("put() again repairs the value", store.put(0x0100, after, sizeof(after)) != 0xFFFFFFFF &&
+    store.get(0x0100, buffer, sizeof(buffer)) == sizeof(after) && !strcmp(buffer, after));
+
+  printf("%s\n", failures ? "FAILED" : "ok");
+  return failures ? 2 : 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file eepromanager_sync.cpp
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief Computes the configuration patch between a board and a desired EEPROM image
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ * @details Compares the KEY, LENGTH and CRC32 of every entry in the capture of EEPROManager::report() with the live
+ * entries of the desired image (e.g. built with eepromanager_build) and writes ENTRY frames for the entries which
+ * differ. Sending the patch to a board waiting in EEPROManager::import() applies them with a single commit.
+ * 
+ * Build: g++ -std=c++11 -O2 -o eepromanager_sync eepromanager_sync.cpp
+ * Usage: eepromanager_sync REPORT DESIRED -o PATCH [--chunk BYTES]
+ * Exit status is 2 when the desired image holds entries the board cannot accept (missing KEY or different LENGTH).
+ */
+
+#include "EEPROManagerHost.h"
+
+#include <stdlib.h>
+#include <map>
+
+using namespace EEPROManagerHost;
+
+/**
+ * @brief Entry summary taken from a REPORT frame
+ * 
+ */
+struct Reported
+{
+  uint32_t WRITE_COUNT;
+  uint16_t LENGTH;
+  uint32_t CRC32;
+};
+
+int main(int argc, char **argv)
+{
+  const char *paths[2] = {NULL, NULL};
+  const char *patchPath = NULL;
+  uint32_t chunk = 64;
+  int positional = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) patchPath = argv[++i];
+    else if (!strcmp(argv[i], "--chunk") && i + 1 < argc) chunk = strtoul(argv[++i], NULL, 0);
+    else if (positional < 2) paths[positional++] = argv[i];
+  }
+  if (positional != 2 || !patchPath || chunk < 4 || chunk > 255)
+  {
+    fprintf(stderr, "Usage: %s REPORT DESIRED -o PATCH [--chunk BYTES (4-255, default 64)]\n", argv[0]);
+    return 1;
+  }
+  std::vector<uint8_t> capture;
+  std::vector<uint8_t> desired;
+  if (!load(paths[0], capture) || !load(paths[1], desired))
+  {
+    fprintf(stderr, "%s: cannot read %s or %s\n", argv[0], paths[0], paths[1]);
+    return 1;
+  }
+
+  // Collect the board's entries from the last complete report in the capture
+  std::map<uint16_t, Reported> board;
+  std::map<uint16_t, Reported> reporting;
+  size_t position = 0;
+  uint8_t type;
+  uint16_t address;
+  const uint8_t *payload;
+  uint8_t length;
+  uint32_t corrupt = 0;
+  bool complete = false;
+  while (next(capture, position, type, address, payload, length, corrupt))
+  {
+    if (type == 'R' && length == 10)
+    {
+      Reported entry = {get32(payload), get16(payload + 4), get32(payload + 6)};
+      reporting[address] = entry;
+    }
+    else if (type == 'Z' && length == 2 && get16(payload) == reporting.size() + 1 && corrupt == 0)
+    {
+      board.swap(reporting);
+      complete = true;
+    }
+    if (type == 'Z')
+    {
+      reporting.clear();
+      corrupt = 0;
+    }
+  }
+  if (!complete)
+  {
+    fprintf(stderr, "%s: no complete report found in %s\n", argv[0], paths[0]);
+    return 1;
+  }
+
+  // Patch every desired entry whose CRC32 differs from the board
+  std::vector<Entry> entries;
+  parse(desired.data(), desired.size(), entries);
+  std::vector<uint8_t> patch;
+  uint16_t frames = 0;
+  uint32_t fullSize = 0;
+  int result = 0;
+  for (size_t e = 0; e < entries.size(); e++)
+  {
+    const Entry &entry = entries[e];
+    if (entry.RETIRED || entry.TRUNCATED)
+    {
+      continue;
+    }
+    fullSize += entry.LENGTH + ((entry.LENGTH + chunk - 3) / (chunk - 2)) * 11;
+    std::map<uint16_t, Reported>::iterator reported = board.find(entry.KEY);
+    if (reported == board.end() || reported->second.LENGTH != entry.LENGTH)
+    {
+      printf("KEY %04X: %s, skipped\n", entry.KEY, reported == board.end() ? "not on the board" : "LENGTH differs from the board");
+      result = 2;
+      continue;
+    }
+    if (reported->second.CRC32 == entry.CRC32)
+    {
+      continue;
+    }
+    printf("KEY %04X: differs (board WRITE_COUNT %u)\n", entry.KEY, reported->second.WRITE_COUNT);
+    for (uint32_t offset = 0; offset < entry.LENGTH; offset += chunk - 2)
+    {
+      uint8_t frameData[255];
+      uint32_t count = entry.LENGTH - offset < chunk - 2 ? entry.LENGTH - offset : chunk - 2;
+      put16(frameData, offset);
+      memcpy(frameData + 2, &desired[entry.ADDRESS + HEADER_SIZE + offset], count);
+      frame(patch, 'E', entry.KEY, frameData, count + 2);
+      frames++;
+    }
+  }
+  uint8_t trailer[2];
+  put16(trailer, ++frames);
+  frame(patch, 'Z', 0, trailer, sizeof(trailer));
+
+  FILE *output = fopen(patchPath, "wb");
+  if (!output || fwrite(patch.data(), 1, patch.size(), output) != patch.size())
+  {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], patchPath);
+    return 1;
+  }
+  fclose(output);
+  printf("%s: %u frames, %zu bytes (full configuration push %u bytes)\n", patchPath, frames, patch.size(), fullSize + 11);
+  return result;
+}
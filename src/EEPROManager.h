@@ -17,6 +17,142 @@
   #define EEPROM_MAX_WRITES 100000
 #endif
 
+/**
+ * @brief Performance counters
+ * 
+ * @details Define EEPROMANAGER_STATS before including the library to keep per-instance counters of the work each
+ * EEPROManager performs. When it is not defined the counters and all code to maintain them are compiled out.
+ */
+#ifdef EEPROMANAGER_STATS
+  #define EEPROMANAGER_STAT(COUNTER, VALUE) _STATS.COUNTER += (VALUE)
+  #define EEPROMANAGER_STAT_START(TIMER) uint32_t TIMER = micros()
+  #define EEPROMANAGER_STAT_STOP(COUNTER, TIMER) _STATS.COUNTER += micros() - TIMER
+#else
+  #define EEPROMANAGER_STAT(COUNTER, VALUE)
+  #define EEPROMANAGER_STAT_START(TIMER)
+  #define EEPROMANAGER_STAT_STOP(COUNTER, TIMER)
+#endif
+
+/**
+ * @brief Latency histograms
+ * 
+ * @details Define EEPROMANAGER_HISTOGRAMS before including the library to record log2 bucketed latency histograms
+ * (micros) of update(), write(), EEPROM commits and begin() for each EEPROManager. Bucket i counts latencies below
+ * 2^(i+1) micros, the last bucket also collects everything longer.
+ */
+#ifndef EEPROMANAGER_HISTOGRAM_BUCKETS
+  #define EEPROMANAGER_HISTOGRAM_BUCKETS 24
+#endif
+
+#ifdef EEPROMANAGER_HISTOGRAMS
+  #define EEPROMANAGER_LATENCY(HISTOGRAM) EEPROManagerLatencyTimer latencyTimer(_LATENCY.HISTOGRAM)
+#else
+  #define EEPROMANAGER_LATENCY(HISTOGRAM)
+#endif
+
+/**
+ * @brief Write trace capture
+ * 
+ * @details Define EEPROMANAGER_TRACE before including the library to record the outcome of every update() call of
+ * every EEPROManager into a RAM ring of EEPROMANAGER_TRACE_DEPTH records. The ring is drained with
+ * EEPROManagerTrace::stream() and the captured workload can be replayed on a host with extras/tools/eepromanager_replay.
+ */
+#ifndef EEPROMANAGER_TRACE_DEPTH
+  #define EEPROMANAGER_TRACE_DEPTH 64
+#endif
+
+#ifdef EEPROMANAGER_TRACE
+  #define EEPROMANAGER_TRACE_START() static_cast<uint32_t>(micros())
+#else
+  #define EEPROMANAGER_TRACE_START() 0
+#endif
+
+/**
+ * @brief Maximum attempts update() makes to take a consistent snapshot of MEMORY guarded by an EEPROManagerSeqLock
+ * 
+ */
+#ifndef EEPROMANAGER_SNAPSHOT_RETRIES
+  #define EEPROMANAGER_SNAPSHOT_RETRIES 16
+#endif
+
+/**
+ * @brief Number of snapshots an EEPROManagerQueue holds
+ * 
+ */
+#ifndef EEPROMANAGER_QUEUE_DEPTH
+  #define EEPROMANAGER_QUEUE_DEPTH 2
+#endif
+
+/**
+ * @brief Binary dump framing
+ * 
+ * @details dump() streams the EEPROM as frames of at most EEPROMANAGER_FRAME_CHUNK payload bytes:
+ *   0x7E | TYPE (1) | ADDRESS (2) | LENGTH (1) | PAYLOAD (LENGTH) | CRC32 of TYPE to PAYLOAD (4)
+ * extras/tools/eepromanager_decode rebuilds the EEPROM image from a captured stream.
+ */
+#ifndef EEPROMANAGER_FRAME_CHUNK
+  #define EEPROMANAGER_FRAME_CHUNK 64
+#endif
+
+/**
+ * @brief Maximum number of different EEPROM ENTRIES a single import() may patch through ENTRY frames
+ * 
+ */
+#ifndef EEPROMANAGER_IMPORT_ENTRIES
+  #define EEPROMANAGER_IMPORT_ENTRIES 16
+#endif
+
+/**
+ * @brief Multi-entry transactions
+ * 
+ * @details EEPROManagerTransaction journals the changed data of several EEPROM ENTRIES into one EEPROM ENTRY with the
+ * reserved KEY EEPROMANAGER_JOURNAL_KEY and EEPROMANAGER_JOURNAL_SIZE data bytes before writing them, so an
+ * interrupted transaction is either discarded or replayed as a whole by EEPROManagerTransaction::recover().
+ */
+#ifndef EEPROMANAGER_JOURNAL_KEY
+  #define EEPROMANAGER_JOURNAL_KEY 0xFFFE
+#endif
+#ifndef EEPROMANAGER_JOURNAL_SIZE
+  #define EEPROMANAGER_JOURNAL_SIZE 128
+#endif
+#ifndef EEPROMANAGER_TRANSACTION_ENTRIES
+  #define EEPROMANAGER_TRANSACTION_ENTRIES 8
+#endif
+
+/**
+ * @brief Runtime key-value store
+ * 
+ * @details EEPROManagerStore keeps the ADDRESS of up to EEPROMANAGER_STORE_SLOTS EEPROM ENTRIES in a RAM hash index
+ * (4 bytes per slot), so put() and get() find an EEPROM ENTRY without walking the chain.
+ */
+#ifndef EEPROMANAGER_STORE_SLOTS
+  #define EEPROMANAGER_STORE_SLOTS 32
+#endif
+
+/**
+ * @brief Field change profiling
+ * 
+ * @details Define EEPROMANAGER_PROFILE before including the library to count, on every change detected by update(),
+ * which of the fields bound with fields() differ from the EEPROM ENTRY. The report printed by print() shows which
+ * fields drive writes.
+ */
+#define EEPROMANAGER_FIELD(TYPE, MEMBER) {#MEMBER, offsetof(TYPE, MEMBER), sizeof(static_cast<TYPE*>(0)->MEMBER), 0}
+
+/**
+ * @brief Named KEYS
+ * 
+ * @details EEPROMANAGER_KEY("net.wifi") hashes the name into a 16 bit KEY at compile time, costing nothing at runtime
+ * compared with a literal KEY. Check for collisions with EEPROManagerRegistry::collisions().
+ */
+#define EEPROMANAGER_KEY(NAME) (EEPROManagerKeyConstant<EEPROManagerKey(NAME)>::VALUE)
+
+/**
+ * @brief Declares the tolerance of a numeric field of a managed object (struct), see EEPROManagerTolerance
+ * 
+ */
+#define EEPROMANAGER_TOLERANCE(TYPE, MEMBER, ABSOLUTE, RELATIVE, STEP) {offsetof(TYPE, MEMBER), \
+  sizeof(static_cast<TYPE*>(0)->MEMBER), EEPROManagerToleranceKind<decltype(static_cast<TYPE*>(0)->MEMBER)>::KIND, ABSOLUTE, RELATIVE, STEP}
+
 /**
  * @class EEPROManager
  * 
@@ -26,263 +162,4348 @@
 #ifndef EEPROManager_h
 
   #define EEPROManager_h
+
+  /**
+   * @brief Describes a byte range (field) of a managed object (struct), declared with EEPROMANAGER_FIELD(TYPE, MEMBER)
+   * 
+   */
+  struct EEPROManagerField
+  {
+    const char *NAME;                                   // Name of the field used in reports
+    uint16_t OFFSET;                                    // Offset of the field within the object (struct)
+    uint16_t SIZE;                                      // Size of the field in bytes
+    uint32_t CHANGES;                                   // Number of writes in which the field changed (EEPROMANAGER_PROFILE)
+  };
+
+  /**
+   * @brief Significance threshold of a numeric field, declared with EEPROMANAGER_TOLERANCE(TYPE, MEMBER, ABSOLUTE, RELATIVE, STEP)
+   * 
+   * @details A field bound with EEPROManager::tolerate() only counts as changed when it moves beyond its threshold
+   * relative to the value in the EEPROM ENTRY: with a STEP above 0 when it rounds to a different multiple of STEP,
+   * otherwise when it differs by more than ABSOLUTE or RELATIVE times the persisted value, whichever is larger. Fields
+   * are floats, doubles or integers of up to 8 bytes; 64 bit integers are compared as doubles, exact up to 2^53.
+   */
+  struct EEPROManagerTolerance
+  {
+    static const uint8_t UNSIGNED = 0;                  // KIND of unsigned integers
+    static const uint8_t SIGNED = 1;                    // KIND of signed integers
+    static const uint8_t FLOATING = 2;                  // KIND of floats and doubles
+
+    uint16_t OFFSET;                                    // Offset of the field within the object (struct)
+    uint16_t SIZE;                                      // Size of the field in bytes
+    uint8_t KIND;                                       // UNSIGNED, SIGNED or FLOATING
+    float ABSOLUTE;                                     // Smallest absolute change that counts
+    float RELATIVE;                                     // Smallest change relative to the persisted value that counts
+    float STEP;                                         // Quantisation step, 0 to use ABSOLUTE and RELATIVE
+
+    double value(const uint8_t *BYTES) const;           // Decodes the field from its bytes
+    bool exceeded(double MEMORY, double PERSISTED) const; // Returns true if MEMORY moved beyond the threshold
+  };
+
+  /**
+   * @brief Maps a field type to its EEPROManagerTolerance KIND
+   * 
+   */
+  template <class V> struct EEPROManagerToleranceKind
+  {
+    static const uint8_t KIND = V(-1) < V(0) ? EEPROManagerTolerance::SIGNED : EEPROManagerTolerance::UNSIGNED;
+  };
+  template <> struct EEPROManagerToleranceKind<float> { static const uint8_t KIND = EEPROManagerTolerance::FLOATING; };
+  template <> struct EEPROManagerToleranceKind<double> { static const uint8_t KIND = EEPROManagerTolerance::FLOATING; };
+
+  /**
+   * @brief FNV-1a hash of a key name, evaluated by the compiler for string literals
+   * 
+   */
+  constexpr uint32_t EEPROManagerHash(const char *NAME, uint32_t HASH = 2166136261UL)
+  {
+    return *NAME ? EEPROManagerHash(NAME + 1, (HASH ^ static_cast<uint8_t>(*NAME)) * 16777619UL) : HASH;
+  }
+
+  /**
+   * @brief Folds a 32 bit hash into a 16 bit KEY, keeping clear of the erased (0xFFFF) and journal (0xFFFE) KEYS
+   * 
+   */
+  constexpr uint16_t EEPROManagerFold(uint16_t KEY)
+  {
+    return KEY >= 0xFFFE ? KEY & 0x7FFF : KEY;
+  }
+
+  /**
+   * @brief Returns the KEY of a named EEPROM ENTRY, e.g. EEPROManagerKey("net.wifi")
+   * 
+   */
+  constexpr uint16_t EEPROManagerKey(const char *NAME)
+  {
+    return EEPROManagerFold((EEPROManagerHash(NAME) >> 16) ^ (EEPROManagerHash(NAME) & 0xFFFF));
+  }
+
+  /**
+   * @brief Range of KEYS owned by a library or module, named KEYS are hashed into [BASE, BASE + SIZE)
+   * 
+   * @details constexpr EEPROManagerNamespace NET = {0x1000, 0x0100}; A range reaching the journal (0xFFFE) and erased
+   * (0xFFFF) KEYS is shortened so key() never returns them.
+   */
+  struct EEPROManagerNamespace
+  {
+    uint16_t BASE;                                      // First KEY of the range
+    uint16_t SIZE;                                      // Number of KEYS in the range
+
+    constexpr uint16_t key(const char *NAME) const      // Returns the KEY of NAME within the range
+    {
+      return span() ? BASE + EEPROManagerHash(NAME) % span() : EEPROManagerFold(BASE);
+    }
+    constexpr uint16_t span() const                     // Returns the number of KEYS hashed into, clear of 0xFFFE and 0xFFFF
+    {
+      return BASE >= 0xFFFE ? 0 : static_cast<uint32_t>(BASE) + SIZE > 0xFFFE ? 0xFFFE - BASE : SIZE;
+    }
+    constexpr bool contains(uint16_t KEY) const         // Returns true if KEY lies within the range
+    {
+      return KEY >= BASE && KEY - BASE < SIZE;
+    }
+  };
+
+  /**
+   * @brief Carries a KEY as a template argument so EEPROMANAGER_KEY() is always folded at compile time
+   * 
+   */
+  template <uint16_t KEY> struct EEPROManagerKeyConstant
+  {
+    static const uint16_t VALUE = KEY;
+  };
+
+  /**
+   * @brief Sequence lock letting update() take consistent snapshots of MEMORY modified by ISRs or another core
+   * 
+   * @details Writers wrap every modification of MEMORY in beginWrite() / endWrite(). Writers must not nest or run
+   * concurrently with each other, readers never block writers and simply retry. The sequence is a single byte on AVR
+   * so ISRs cannot tear it.
+   */
+  class EEPROManagerSeqLock
+  {
+    public:
+      #ifdef __AVR__
+      typedef uint8_t Sequence;
+      #else
+      typedef uint32_t Sequence;
+      #endif
+
+      void beginWrite();                                // Marks MEMORY as being modified
+      void endWrite();                                  // Marks the modification of MEMORY as complete
+      Sequence readBegin() const;                       // Waits for any modification to complete and returns the sequence
+      bool readRetry(Sequence SEQUENCE) const;          // Returns true if MEMORY was modified since readBegin()
+
+    private:
+      volatile Sequence _SEQUENCE = 0;                  // Odd while a modification is in progress
+  };
+
+  /**
+   * @brief Adaptive write-back delay for MEMORY changed in bursts
+   * 
+   * @details Bound with EEPROManager::debounce(). Every distinct change of MEMORY seen by update() is a change event;
+   * the average gap between events of a burst (gaps shorter than MAXIMUM) sets the delay for which MEMORY has to stay
+   * unchanged before it is written, twice the average gap capped at MAXIMUM. A change after a quiet period of MAXIMUM
+   * or more starts a new burst with no delay, so rare changes are still written on the first update().
+   */
+  class EEPROManagerDebounce
+  {
+    public:
+      EEPROManagerDebounce(uint32_t MAXIMUM = 2000);    // Constructor which sets the longest delay in millis
+      bool due(uint32_t MEMORY_CRC32, uint32_t NOW);    // Records a change event and returns true once MEMORY has settled
+      void settled(uint32_t MEMORY_CRC32, uint32_t NOW); // Drops a pending change once MEMORY matches the EEPROM ENTRY again
+      uint32_t delay() const;                           // Returns the current write-back delay in millis
+      uint32_t avoided() const;                         // Returns the number of changes overwritten before they were written
+
+    private:
+      uint32_t _MAXIMUM;                                // Longest delay, also the quiet period ending a burst
+      uint32_t _INTERVAL = 0;                           // Running average gap between change events of the current burst
+      uint32_t _LAST_CHANGE = 0;                        // millis() of the last change event
+      uint32_t _CRC32 = 0;                              // CRC32 of MEMORY at the last change event
+      uint32_t _AVOIDED = 0;                            // Change events superseded before being written
+      bool _STARTED = false;                            // A change event has been recorded
+      bool _PENDING = false;                            // The last change event has not been written yet
+  };
+
+  /**
+   * @brief Token bucket turning the EEPROM lifetime into a guaranteed property
+   * 
+   * @details Every EEPROM byte survives EEPROM_MAX_WRITES writes, so over LIFETIME the EEPROM can absorb
+   * EEPROM.length() * EEPROM_MAX_WRITES written bytes. Each write of an EEPROM ENTRY wears as many bytes as the entry
+   * occupies (13 + LENGTH, the space a relocation consumes every EEPROM_MAX_WRITES writes) and has to be paid from a
+   * bucket refilled at the sustainable rate. Writes of EEPROManagers with a priority() of at least CRITICAL are always
+   * made and may run the bucket into debt, all others are deferred (update() returns 0) until enough has been refilled.
+   * Transactions and the EEPROManagerStore pay the same way, imports are debited after the fact.
+   * The bucket lives in RAM and starts full after every reset.
+   */
+  class EEPROManagerBudget
+  {
+    public:
+      static void begin(uint32_t LIFETIME_HOURS, uint32_t BURST = 0, uint8_t CRITICAL = 255); // Enables the budget
+      static void end();                                // Disables the budget
+      static bool spend(uint16_t BYTES, uint8_t PRIORITY); // Pays for a write, returns false if it must be deferred
+      static void debit(uint32_t BYTES);                // Pays for a write which cannot be deferred
+      static uint32_t rate();                           // Returns the sustainable rate in bytes per hour
+      static uint32_t available();                      // Returns the bytes which can be written right now
+      static uint32_t deferred();                       // Returns the number of writes deferred
+
+    private:
+      struct Bucket
+      {
+        bool ENABLED;                                   // begin() has been called
+        uint8_t CRITICAL;                               // Lowest priority which is never deferred
+        int64_t TOKENS;                                 // Balance in bytes times LIFETIME millis
+        int64_t CAPACITY;                               // Bucket size in bytes times LIFETIME millis
+        uint64_t LIFETIME;                              // Target lifetime in millis
+        uint32_t LAST;                                  // millis() of the last refill
+        uint32_t DEFERRED;                              // Writes deferred
+      };
+      static Bucket& bucket();                          // Returns the bucket shared by all translation units
+      static void refill();                             // Adds the tokens earned since the last refill
+  };
+
+  /**
+   * @brief Lock-free single producer / single consumer queue of MEMORY snapshots
+   * 
+   * @details Used to offload persistence to another core: the producer publishes snapshots with
+   * EEPROManager::publish() and the consumer persists them with EEPROManager::service(). Slots are filled and drained
+   * in place so a snapshot is copied exactly once.
+   */
+  template <class T> class EEPROManagerQueue
+  {
+    public:
+      T* slot();                                        // Producer: returns the next free slot or 0 if the queue is full
+      void push();                                      // Producer: publishes the slot returned by slot()
+      const T* front() const;                           // Consumer: returns the oldest snapshot or 0 if the queue is empty
+      uint8_t size() const;                             // Consumer: returns the number of queued snapshots
+      void pop();                                       // Consumer: releases the snapshot returned by front()
+
+    private:
+      alignas(T) uint8_t _SLOTS[EEPROMANAGER_QUEUE_DEPTH + 1][sizeof(T)]; // Snapshot storage, one slot is always free
+      volatile uint8_t _HEAD = 0;                       // Next slot written by the producer
+      volatile uint8_t _TAIL = 0;                       // Next slot read by the consumer
+  };
+
+  class EEPROManagerRegistry;
+
+  /**
+   * @brief Type independent part of every EEPROManager
+   * 
+   * @details Keeps a list of all constructed EEPROManagers so they can be reloaded after the EEPROM has been changed
+   * behind their backs, and lets several EEPROM writes share a single commit on flash based EEPROMs. The list is
+   * ordered by priority, most recently constructed first within the same priority.
+   */
+  class EEPROManagerBase
+  {
+    public:
+      virtual uint32_t update() = 0;                    // Updates the EEPROM ENTRY if MEMORY has changed
+      virtual bool changed() = 0;                       // Returns true if MEMORY differs from the EEPROM ENTRY
+      virtual void reload() = 0;                        // Reloads MEMORY from the EEPROM ENTRY
+      virtual uint16_t key() const = 0;                 // Returns the unique KEY of the EEPROM ENTRY
+      EEPROManagerBase* next() const;                   // Returns the next EEPROManager in the list
+      void priority(uint8_t PRIORITY);                  // Sets the priority used by EEPROManagerRegistry::updateAll()
+      uint8_t priority() const;                         // Returns the priority of the EEPROManager
+      void deadline(uint32_t DEADLINE);                 // Sets the longest time MEMORY may stay unwritten for EEPROManagerRegistry::schedule()
+      uint32_t deadline() const;                        // Returns the deadline in millis
+
+      static EEPROManagerBase* first();                 // Returns the first EEPROManager in the list
+      static void reloadAll();                          // Reloads every EEPROManager from the EEPROM
+      static void holdCommit();                         // Defers EEPROM commits until the matching releaseCommit()
+      static void releaseCommit();                      // Performs a single commit if any were deferred
+      static void requestCommit();                      // Commits now, or at releaseCommit() while commits are held
+      static bool header(uint32_t ADDRESS, uint16_t &KEY, uint32_t &WRITE_COUNT, uint16_t &LENGTH); // Reads the EEPROM ENTRY header at ADDRESS
+      static uint16_t find(uint16_t KEY, uint16_t &LENGTH); // Returns the ADDRESS of the live EEPROM ENTRY with KEY
+      static uint16_t end();                            // Returns the ADDRESS following the last EEPROM ENTRY
+      static uint32_t checksum(uint16_t ADDRESS, uint16_t LENGTH); // Calculates the CRC32 of an EEPROM region
+      static bool reserved(uint16_t KEY);               // Returns true for EEPROMANAGER_JOURNAL_KEY and the erased KEY 0xFFFF
+
+    protected:
+      EEPROManagerBase();                               // Adds the EEPROManager to the list
+      ~EEPROManagerBase();                              // Removes the EEPROManager from the list
+      static bool commitHeld();                         // Returns true (and records the deferred commit) while commits are held
+      virtual uint16_t stage(uint16_t ADDRESS, uint16_t ROOM) = 0; // Journals changed MEMORY at ADDRESS for a transaction
+      virtual void refresh() = 0;                       // Rereads WRITE_COUNT and CRC32 after the EEPROM ENTRY was written externally
+      virtual uint32_t flush() = 0;                     // Updates the EEPROM ENTRY reusing the CRC32 of the preceding changed()
+
+    private:
+      friend class EEPROManagerTransaction;
+      friend class EEPROManagerRegistry;
+      struct CommitState
+      {
+        uint8_t HOLD;                                   // Nesting depth of holdCommit()
+        bool PENDING;                                   // A commit was deferred
+      };
+      static EEPROManagerBase*& head();                 // Returns the head of the list shared by all translation units
+      static CommitState& commitState();                // Returns the commit state shared by all translation units
+      void link();                                      // Inserts the EEPROManager into the list behind higher priorities
+      void unlink();                                    // Removes the EEPROManager from the list
+
+      EEPROManagerBase *_NEXT;                          // Next EEPROManager in the list
+      uint8_t _PRIORITY = 0;                            // 0 for round-robin, higher values are updated on every updateAll() first
+      bool _DIRTY = false;                              // schedule() found MEMORY changed and has not written it yet
+      uint32_t _DEADLINE = 0;                           // Longest time in millis MEMORY may stay unwritten
+      uint32_t _DIRTY_SINCE = 0;                        // millis() at which schedule() first found MEMORY changed
+  };
+
+  /**
+   * @brief Updates every EEPROManager from one place with a single commit per round
+   * 
+   * @details Replaces calling update() on each EEPROManager in loop(). Prioritised EEPROManagers (priority() above 0)
+   * are checked on every call, highest first; the others are checked round-robin, continuing where the previous call
+   * stopped, until the time budget is spent. At least one of them is checked per call so every EEPROManager is
+   * eventually reached.
+   * 
+   * schedule() is the deadline driven alternative: it only checks for changes on every call and writes once the
+   * earliest deadline() of a changed EEPROManager is due, together with every other changed EEPROManager due within
+   * the commit window, so urgent settings hit the EEPROM quickly while slow ones ride along in the same commit.
+   */
+  class EEPROManagerRegistry
+  {
+    public:
+      static uint8_t updateAll(uint32_t BUDGET = 0xFFFFFFFF); // Updates EEPROManagers for up to BUDGET micros and commits once
+      static uint8_t count();                           // Returns the number of registered EEPROManagers
+      static uint8_t failed();                          // Returns the number of writes the last updateAll() or schedule() found no EEPROM space for
+      static uint8_t schedule(uint32_t WINDOW = 0);     // Writes changed EEPROManagers by deadline, batching those due within WINDOW millis
+      static uint8_t collisions(Stream* stream = 0);    // Returns the number of KEYS used by more than one EEPROManager
+
+    private:
+      friend class EEPROManagerBase;
+      static EEPROManagerBase*& cursor();               // Returns the next round-robin EEPROManager, 0 to start over
+      static uint8_t& failures();                       // Returns the number of failed writes of the last round
+      static void tally(uint32_t WRITE_COUNT, uint8_t &WRITTEN); // Counts the result of an update() as written or failed
+  };
+
+  /**
+   * @brief Frame based binary transfer of EEPROM contents
+   * 
+   */
+  class EEPROManagerFrame
+  {
+    public:
+      static const uint8_t SYNC = 0x7E;                 // First byte of every frame
+      static const uint8_t HEADER = 'H';                // Start of a dump, PAYLOAD: EEPROM length (2), flags (1)
+      static const uint8_t DATA = 'D';                  // EEPROM bytes starting at ADDRESS
+      static const uint8_t FILL = 'F';                  // Run of identical bytes at ADDRESS, PAYLOAD: count (2), value (1)
+      static const uint8_t ENTRY = 'E';                 // Data of the EEPROM ENTRY with KEY ADDRESS, PAYLOAD: offset (2), data
+      static const uint8_t REPORT = 'R';                // Summary of the live EEPROM ENTRY with KEY ADDRESS, PAYLOAD: WRITE_COUNT (4), LENGTH (2), CRC32 (4)
+      static const uint8_t END = 'Z';                   // End of a dump, PAYLOAD: number of frames sent (2)
+      static const uint8_t LIVE_ONLY = 0x01;            // HEADER flag: only live EEPROM ENTRIES were sent
+
+      static const uint8_t IMPORT_OK = 0;               // import(): all frames applied
+      static const uint8_t IMPORT_TIMEOUT = 1;          // import(): stream timed out before the END frame
+      static const uint8_t IMPORT_CORRUPT = 2;          // import(): frame failed its CRC32 or was malformed
+      static const uint8_t IMPORT_SIZE = 3;             // import(): image size or frame range does not fit the EEPROM
+      static const uint8_t IMPORT_KEY = 4;              // import(): ENTRY frame for a KEY with no live EEPROM ENTRY
+      static const uint8_t IMPORT_OVERFLOW = 5;         // import(): more than EEPROMANAGER_IMPORT_ENTRIES entries patched
+      static const uint8_t IMPORT_INCOMPLETE = 6;       // import(): END frame count does not match the frames received
+
+      static void send(Stream* stream, uint8_t TYPE, uint16_t ADDRESS, const uint8_t *PAYLOAD, uint8_t LENGTH); // Sends a single frame
+      static uint16_t dump(Stream* stream, bool LIVE_ONLY); // Sends the EEPROM as a framed dump
+      static uint16_t report(Stream* stream);           // Sends a REPORT frame for every live EEPROM ENTRY
+      static uint8_t receive(Stream* stream, uint8_t &TYPE, uint16_t &ADDRESS, uint8_t *PAYLOAD, uint8_t &LENGTH); // Receives a single frame
+      static uint8_t import(Stream* stream);            // Applies a framed image or set of entries and reloads all EEPROManagers
+
+    private:
+      static uint16_t region(Stream* stream, uint16_t ADDRESS, uint16_t LENGTH); // Sends an EEPROM region as DATA and FILL frames
+      static bool store(uint16_t ADDRESS, uint8_t VALUE); // Writes a byte if it differs from the EEPROM, returns true if written
+  };
+
+  #ifdef EEPROMANAGER_STATS
+  /**
+   * @brief Counters kept by each EEPROManager when EEPROMANAGER_STATS is defined
+   * 
+   */
+  struct EEPROManagerStats
+  {
+    uint32_t UPDATE_CALLS;                              // Number of calls to update()
+    uint32_t UNCHANGED;                                 // Number of update() calls which found MEMORY unchanged
+    uint32_t CRC_BYTES;                                 // Number of bytes hashed by CRC8 and CRC32
+    uint32_t BYTES_READ;                                // Number of bytes read from the EEPROM
+    uint32_t BYTES_WRITTEN;                             // Number of bytes written to the EEPROM
+    uint32_t COMMITS;                                   // Number of EEPROM commits
+    uint32_t RELOCATIONS;                               // Number of times the ENTRY was moved after reaching EEPROM_MAX_WRITES
+    uint32_t LOCATE_STEPS;                              // Number of EEPROM ENTRY headers inspected by locate()
+    uint32_t CRC_MICROS;                                // Cumulative micros spent calculating CRCs
+    uint32_t LOCATE_MICROS;                             // Cumulative micros spent in locate()
+    uint32_t READ_MICROS;                               // Cumulative micros spent reading the EEPROM ENTRY
+    uint32_t WRITE_MICROS;                              // Cumulative micros spent writing the EEPROM ENTRY (excluding commits)
+    uint32_t COMMIT_MICROS;                             // Cumulative micros spent committing the EEPROM
+  };
+  #endif
+
+  #ifdef EEPROMANAGER_HISTOGRAMS
+  /**
+   * @brief Fixed size log2 bucketed latency histogram
+   * 
+   */
+  struct EEPROManagerHistogram
+  {
+    uint16_t BUCKETS[EEPROMANAGER_HISTOGRAM_BUCKETS];   // Saturating sample counts, bucket i holds latencies below 2^(i+1) micros
+    uint32_t MAX;                                       // Longest latency recorded in micros
+
+    void record(uint32_t LATENCY);                      // Adds a latency sample in micros
+    uint32_t samples() const;                           // Returns the number of samples recorded
+    uint32_t percentile(uint8_t PERCENT) const;         // Returns the exclusive upper bound in micros of the bucket holding the PERCENT percentile
+    void print(Stream* stream, const char* NAME) const; // Prints the non-empty buckets to the assigned stream
+  };
+
+  /**
+   * @brief Latency histograms kept by each EEPROManager when EEPROMANAGER_HISTOGRAMS is defined
+   * 
+   */
+  struct EEPROManagerLatency
+  {
+    EEPROManagerHistogram UPDATE;                       // Latency of update() calls
+    EEPROManagerHistogram WRITE;                        // Latency of full EEPROM ENTRY writes
+    EEPROManagerHistogram COMMIT;                       // Latency of EEPROM commits
+    EEPROManagerHistogram BEGIN;                        // Latency of locating and loading the EEPROM ENTRY
+  };
+
+  /**
+   * @brief Records the lifetime of its scope into a histogram
+   * 
+   */
+  class EEPROManagerLatencyTimer
+  {
+    public:
+      EEPROManagerLatencyTimer(EEPROManagerHistogram &HISTOGRAM) : _HISTOGRAM(HISTOGRAM), _START(micros()) {}
+      ~EEPROManagerLatencyTimer() { _HISTOGRAM.record(micros() - _START); }
+
+    private:
+      EEPROManagerHistogram &_HISTOGRAM;                // Histogram receiving the sample
+      uint32_t _START;                                  // micros() when the scope was entered
+  };
+  #endif
+
+  #ifdef EEPROMANAGER_TRACE
+  /**
+   * @brief Outcome of a single update() call
+   * 
+   * @details Streamed little endian as 0xA5, the 18 record bytes in declaration order and a CRC8 of those bytes.
+   */
+  struct EEPROManagerTraceRecord
+  {
+    uint32_t TIME;                                      // micros() when update() was called
+    uint16_t KEY;                                       // KEY of the EEPROM ENTRY
+    uint16_t LENGTH;                                    // LENGTH of the EEPROM ENTRY data
+    uint16_t CHANGED;                                   // Number of data bytes which differed from the EEPROM ENTRY
+    uint32_t WRITE_COUNT;                               // Value returned by update()
+    uint32_t LATENCY;                                   // Duration of the update() call in micros
+  };
+
+  /**
+   * @brief RAM ring of update() outcomes shared by all EEPROManagers
+   * 
+   */
+  class EEPROManagerTrace
+  {
+    public:
+      static void record(const EEPROManagerTraceRecord &RECORD);  // Appends a record, overwriting the oldest when full
+      static uint16_t available();                                // Returns the number of records waiting in the ring
+      static bool pop(EEPROManagerTraceRecord &RECORD);           // Removes the oldest record from the ring
+      static uint16_t stream(Stream* stream);                     // Streams and removes all waiting records as framed binary
+      static uint32_t dropped();                                  // Returns the number of records overwritten before being read
+      static uint16_t difference(uint16_t ADDRESS, const uint8_t *DATA, uint16_t LENGTH); // Counts bytes of DATA differing from the EEPROM
+
+    private:
+      struct Ring
+      {
+        EEPROManagerTraceRecord RECORDS[EEPROMANAGER_TRACE_DEPTH];
+        uint16_t HEAD;                                  // Index of the next record to write
+        uint16_t COUNT;                                 // Number of records waiting
+        uint32_t DROPPED;                               // Number of records overwritten
+      };
+      static Ring& ring();                              // Returns the ring shared by all translation units
+  };
+  #endif
   
-  template <class T> class EEPROManager 
+  /**
+   * @brief Writes the changes of several EEPROManagers atomically with a single commit
+   * 
+   * @details commit() journals the data of every changed member, seals the journal with its CRC32, writes the members
+   * and then marks the journal applied, all under one holdCommit(). A reset during the writes leaves a sealed journal
+   * which recover() replays, a reset before the seal leaves the members untouched. Call recover() in setup() after
+   * synchronise() (or construction on AVR), it reloads every EEPROManager if it replayed a journal. Writes made by a
+   * transaction stop one short of retiring an EEPROM ENTRY, the next update() relocates it.
+   */
+  class EEPROManagerTransaction
   {
+    public:
+      static const uint8_t TRANSACTION_OK = 0;          // commit(): all changed members written (or none changed)
+      static const uint8_t TRANSACTION_FULL = 1;        // add(): EEPROMANAGER_TRANSACTION_ENTRIES members already added
+      static const uint8_t TRANSACTION_SPACE = 2;       // commit(): no EEPROM space left for the journal
+      static const uint8_t TRANSACTION_OVERFLOW = 3;    // commit(): the changes do not fit into EEPROMANAGER_JOURNAL_SIZE
+      static const uint8_t TRANSACTION_BUDGET = 4;      // commit(): deferred by the EEPROManagerBudget, commit() again later
+
+      uint8_t add(EEPROManagerBase &MANAGER);           // Adds an EEPROManager to the transaction
+      uint8_t commit();                                 // Writes all changed members atomically with a single commit
+      static bool recover();                            // Replays a transaction interrupted by a reset
+
+    private:
+      static uint16_t journal();                        // Returns the ADDRESS of the journal, creating it if needed
+      static void replay(uint16_t JOURNAL, uint16_t LENGTH); // Writes every journalled record into its EEPROM ENTRY
+      static void seal(uint16_t JOURNAL, uint16_t LENGTH, uint8_t STATE); // Writes the journal STATE and CRC32
+
+      EEPROManagerBase *_MEMBERS[EEPROMANAGER_TRANSACTION_ENTRIES]; // Members of the transaction
+      uint8_t _COUNT = 0;                               // Number of members
+  };
+
+  template <class T> class EEPROManager : public EEPROManagerBase
+  {
+    static_assert(__is_trivially_copyable(T), "EEPROManager<T> stores the bytes of T: manage types holding pointers or Strings with EEPROManagerSerial<T>");
+
     public:
       EEPROManager(T *MEMORY, uint16_t KEY = 0x0001);   // Constructor which sets the EEPROM ENTRY unique KEY and binds the MEMORY
       uint32_t update();                                // Updates the EEPROM ENTRY if the MEMORY has changed since last check
+      bool changed();                                   // Returns true if MEMORY differs from the EEPROM ENTRY, without writing
       void synchronise();                               // Scynhronises the EEPROM similar to the constructor in case the constructor method is not supported
       void reset();                                     // Resets the entire EEPROM back to default data (0xFF, 0xFF...)
       void print(Stream* stream);                       // Dumps the memory to the assigned stream for use with printing and debugging
+      uint16_t dump(Stream* stream, bool LIVE_ONLY = false); // Dumps the memory to the assigned stream as CRC protected binary frames
+      uint8_t import(Stream* stream);                   // Writes a framed image or set of entries from the assigned stream into the EEPROM
+      uint16_t report(Stream* stream);                  // Reports KEY, WRITE_COUNT, LENGTH and CRC32 of every live EEPROM ENTRY to the assigned stream
+      void reload();                                    // Reloads MEMORY from the EEPROM ENTRY after the EEPROM was changed externally
+      uint16_t key() const;                             // Returns the unique KEY of the EEPROM ENTRY
+      void fields(EEPROManagerField *FIELDS, uint8_t COUNT); // Binds descriptors of the fields of MEMORY
+      void exclude(const EEPROManagerField *FIELDS, uint8_t COUNT); // Excludes runtime-only fields of MEMORY from change detection
+      void tolerate(const EEPROManagerTolerance *TOLERANCES, uint8_t COUNT); // Binds significance thresholds of numeric fields
+      void seqlock(EEPROManagerSeqLock *LOCK);          // Binds a sequence lock so update() persists consistent snapshots of MEMORY
+      void offload(EEPROManagerQueue<T> *QUEUE);        // Binds a queue through which another core persists MEMORY
+      void debounce(EEPROManagerDebounce *DEBOUNCE);    // Binds an adaptive delay so bursts of changes are written once
+      bool publish();                                   // Producer core: queues a snapshot of MEMORY for service()
+      uint32_t service();                               // Consumer core: persists the latest queued snapshot
+      #ifdef EEPROMANAGER_STATS
+      const EEPROManagerStats& stats() const;           // Returns the performance counters of this EEPROManager
+      void resetStats();                                // Clears the performance counters of this EEPROManager
+      #endif
+      #ifdef EEPROMANAGER_HISTOGRAMS
+      const EEPROManagerLatency& latency() const;       // Returns the latency histograms of this EEPROManager
+      void resetLatency();                              // Clears the latency histograms of this EEPROManager
+      #endif
              
     private:
       void begin();                                     // Function used to initialise the EEPROM
       void initialise();                                // Initialises the CRC8, WRITE_COUNT, LENGTH and CRC32
       uint8_t locate();                                 // Locates a valid EEPROM ENTRY matching MEMORY or uninitialised space ready for writing
-      void write();                                     // Writes the current MEMORY into the EEPROM ENTRY at the current ADDRESS
+      void write(const T &DATA);                        // Writes DATA (MEMORY or a snapshot of it) into the EEPROM ENTRY at the current ADDRESS
       void read();                                      // Reads the current EEPROM ENTRY at the current ADDRESS into MEMORY
-      
+      uint32_t checksum(const T &DATA);                 // Calculates the CRC32 of DATA (MEMORY or a snapshot of it) without the excluded fields
+      uint32_t stored(const T &DATA);                   // Returns the CRC32 of all of DATA stored in the EEPROM ENTRY
+      bool differs(const T &DATA, uint32_t MEMORY_CRC32); // Returns true if DATA differs significantly from the EEPROM ENTRY
+      bool moved(const T &DATA);                        // Returns true if a toleranced field of DATA moved beyond its threshold
+      bool snapshot(T &DATA);                           // Takes a consistent copy of MEMORY guarded by the bound EEPROManagerSeqLock
+      uint32_t persist(const T &DATA, uint32_t MEMORY_CRC32, uint32_t START); // Writes DATA to the EEPROM ENTRY if it differs from the EEPROM ENTRY
+      void commit();                                    // Commits the EEPROM on boards with flash based EEPROMs
+
+    protected:
+      uint16_t stage(uint16_t ADDRESS, uint16_t ROOM);  // Journals MEMORY at ADDRESS if it differs from the EEPROM ENTRY
+      void refresh();                                   // Rereads WRITE_COUNT and CRC32 after a transaction wrote the EEPROM ENTRY
+      uint32_t flush();                                 // Updates the EEPROM ENTRY reusing the CRC32 of the preceding changed()
+
+    private:
       uint16_t _ADDRESS = 0;                            // Current EEPROM ENTRY starting ADDRESS
       T *_MEMORY;                                       // Pointer to MEMORY struct which is monitored for changes
+      EEPROManagerSeqLock *_SEQLOCK = 0;                // Sequence lock guarding MEMORY against concurrent writers
+      EEPROManagerQueue<T> *_QUEUE = 0;                 // Queue of snapshots persisted by service()
+      EEPROManagerDebounce *_DEBOUNCE = 0;              // Adaptive delay applied to changes before they are written
       uint16_t _ENTRY_KEY;                              // Unique KEY used for identifying EEPROM ENTRY
       uint8_t _ENTRY_CRC8;                              // CRC8 used to check EEPROM ENTRY validity
       uint32_t _ENTRY_WRITE_COUNT;                      // Current EEPROM ENTRY WRITE_COUNT
       uint16_t _ENTRY_LENGTH;                           // LENGTH of the EEPROM ENTRY data
-      uint32_t _ENTRY_CRC32;                            // CRC32 used to check EEPROM ENTRY validity
+      uint32_t _ENTRY_CRC32;                            // CRC32 of the EEPROM ENTRY data without the excluded fields
+      uint32_t _CHANGED_CRC32 = 0;                      // checksum() of MEMORY calculated by the last changed()
+      bool _CHANGED_VALID = false;                      // _CHANGED_CRC32 may be reused by flush()
+      EEPROManagerField *_FIELDS = 0;                   // Descriptors of the fields of MEMORY
+      uint8_t _FIELD_COUNT = 0;                         // Number of field descriptors
+      const EEPROManagerField *_EXCLUDED = 0;           // Fields ignored by change detection, in ascending OFFSET order
+      uint8_t _EXCLUDED_COUNT = 0;                      // Number of excluded fields
+      const EEPROManagerTolerance *_TOLERANCES = 0;     // Thresholds of numeric fields, in ascending OFFSET order
+      uint8_t _TOLERANCE_COUNT = 0;                     // Number of toleranced fields
+      #ifdef EEPROMANAGER_PROFILE
+      uint32_t _PROFILE_WRITES = 0;                     // Number of profiled writes
+      uint32_t _PROFILE_UNMAPPED = 0;                   // Number of writes which changed bytes outside the bound fields
+      void profile(const T &DATA);                      // Counts the fields of DATA which differ from the EEPROM ENTRY
+      #endif
+      #ifdef EEPROMANAGER_STATS
+      EEPROManagerStats _STATS = {};                    // Performance counters
+      #endif
+      #ifdef EEPROMANAGER_HISTOGRAMS
+      EEPROManagerLatency _LATENCY = {};                // Latency histograms
+      #endif
   };
 
-#endif
+  /**
+   * @brief Describes how to serialise a type which is not trivially copyable, specialised by the sketch for each type
+   * 
+   * @details A specialisation provides SIZE, the encoded size in bytes, and a visit() function handing every field to
+   * the coder: value() for trivially copyable fields (sizeof bytes), string() for Strings (CAPACITY + 1 bytes) and
+   * array() for arrays of trivially copyable values:
+   * 
+   *   template <> struct EEPROManagerLayout<Settings>
+   *   {
+   *     static const uint16_t SIZE = 1 + 16 + sizeof(uint16_t);
+   *     template <class CODER> static void visit(CODER &coder, Settings &settings)
+   *     {
+   *       coder.string(settings.ID, 16);
+   *       coder.value(settings.Version);
+   *     }
+   *   };
+   */
+  template <class T> struct EEPROManagerLayout;
+
+  /**
+   * @brief Writes fields into a fixed size staging buffer, bytes past the end of the buffer are dropped
+   * 
+   */
+  class EEPROManagerEncoder
+  {
+    public:
+      EEPROManagerEncoder(uint8_t *BUFFER, uint16_t SIZE);
+      template <class V> void value(const V &VALUE);    // Encodes a trivially copyable field
+      template <class V> void array(const V *VALUES, uint16_t COUNT); // Encodes an array of trivially copyable values
+      void string(const String &VALUE, uint8_t CAPACITY); // Encodes a String as LENGTH (1) and CAPACITY characters
+
+    private:
+      void bytes(const void *DATA, uint16_t LENGTH);    // Copies bytes into the buffer
+
+      uint8_t *_BUFFER;                                 // Staging buffer
+      uint16_t _SIZE;                                   // Size of the staging buffer
+      uint16_t _POSITION = 0;                           // Next byte to write
+  };
+
+  /**
+   * @brief Reads fields from a fixed size staging buffer
+   * 
+   */
+  class EEPROManagerDecoder
+  {
+    public:
+      EEPROManagerDecoder(const uint8_t *BUFFER, uint16_t SIZE);
+      template <class V> void value(V &VALUE);          // Decodes a trivially copyable field
+      template <class V> void array(V *VALUES, uint16_t COUNT); // Decodes an array of trivially copyable values
+      void string(String &VALUE, uint8_t CAPACITY);     // Decodes a String, reusing its buffer
+
+    private:
+      void bytes(void *DATA, uint16_t LENGTH);          // Copies bytes out of the buffer
+
+      const uint8_t *_BUFFER;                           // Staging buffer
+      uint16_t _SIZE;                                   // Size of the staging buffer
+      uint16_t _POSITION = 0;                           // Next byte to read
+  };
+
+  /**
+   * @brief Encoded form of T, the data of the EEPROM ENTRY of an EEPROManagerSerial<T>
+   * 
+   */
+  template <class T> struct EEPROManagerImage
+  {
+    uint8_t BYTES[EEPROManagerLayout<T>::SIZE];
+  };
+
+  /**
+   * @brief Raw bytes of a part of T, the data of the EEPROM ENTRY of an EEPROManagerSplit<T, HOT_SIZE> part
+   * 
+   */
+  template <uint16_t SIZE> struct EEPROManagerBytes
+  {
+    uint8_t BYTES[SIZE];
+  };
+
+  /**
+   * @brief Holds the staging buffer of an EEPROManagerSerial<T>, encoding MEMORY through EEPROManagerLayout<T>
+   * 
+   */
+  template <class T> class EEPROManagerSerialStorage
+  {
+    public:
+      typedef EEPROManagerImage<T> Image;
+
+      EEPROManagerSerialStorage(T *MEMORY);             // Binds MEMORY and encodes it into the staging buffer
+
+    protected:
+      void encode();                                    // Serialises MEMORY into the staging buffer
+      void decode();                                    // Deserialises the staging buffer into MEMORY
+
+      T *_SERIAL_MEMORY;                                // MEMORY holding Strings or pointers
+      Image _IMAGE;                                     // Staging buffer managed by the EEPROManager base
+  };
+
+  /**
+   * @brief Holds the staging buffer of one part of an EEPROManagerSplit<T, HOT_SIZE>
+   * 
+   * @details The hot part holds the bound fields one after another, the cold part holds every byte between them.
+   */
+  template <class T, uint16_t SIZE> class EEPROManagerSplitStorage
+  {
+    public:
+      typedef EEPROManagerBytes<SIZE> Image;
+
+      EEPROManagerSplitStorage(T *MEMORY, const EEPROManagerField *FIELDS, uint8_t COUNT, bool HOT); // Binds the part of MEMORY and gathers it
+
+    protected:
+      void encode();                                    // Gathers the part of MEMORY into the staging buffer
+      void decode();                                    // Scatters the staging buffer into the part of MEMORY
+
+    private:
+      void copy(bool GATHER);                           // Copies the byte ranges of the part in either direction
+
+    protected:
+      T *_SPLIT_MEMORY;                                 // MEMORY split into a hot and a cold part
+      const EEPROManagerField *_HOT_FIELDS;             // Fields of the hot part, in ascending OFFSET order
+      uint8_t _HOT_COUNT;                               // Number of fields of the hot part
+      bool _HOT;                                        // This is the hot part
+      Image _IMAGE;                                     // Staging buffer managed by the EEPROManager base
+  };
+
+  /**
+   * @brief EEPROManager of a staging buffer which STORAGE fills from MEMORY before every check and empties into MEMORY
+   * after every read
+   * 
+   * @details STORAGE derives first so the buffer is filled before the EEPROManager base locates or creates the
+   * EEPROM ENTRY. Every other EEPROManager feature works on the staging buffer.
+   */
+  template <class STORAGE> class EEPROManagerStaged : private STORAGE, public EEPROManager<typename STORAGE::Image>
+  {
+    public:
+      EEPROManagerStaged(const STORAGE &STAGING, uint16_t KEY); // Constructor which sets the EEPROM ENTRY unique KEY and binds the staging buffer
+      uint32_t update();                                // Encodes MEMORY and updates the EEPROM ENTRY if it has changed
+      bool changed();                                   // Encodes MEMORY and returns true if it differs from the EEPROM ENTRY
+      void synchronise();                               // Synchronises flash based EEPROMs and decodes the EEPROM ENTRY into MEMORY
+      void reload();                                    // Reloads and decodes MEMORY from the EEPROM ENTRY
+
+    protected:
+      uint16_t stage(uint16_t ADDRESS, uint16_t ROOM);  // Encodes MEMORY and journals it for a transaction
+
+    private:
+      typedef EEPROManager<typename STORAGE::Image> Manager;
+  };
+
+  /**
+   * @brief EEPROManager for types which are not trivially copyable, serialised through EEPROManagerLayout<T>
+   * 
+   * @details MEMORY is encoded into a fixed size staging buffer on every update() with no heap allocations, and the
+   * buffer is what the EEPROM ENTRY holds. Reads decode the buffer back into MEMORY, Strings reuse their buffer once
+   * it has grown to the capacity.
+   */
+  template <class T> class EEPROManagerSerial : public EEPROManagerStaged< EEPROManagerSerialStorage<T> >
+  {
+    public:
+      EEPROManagerSerial(T *MEMORY, uint16_t KEY = 0x0001); // Constructor which sets the EEPROM ENTRY unique KEY and binds the MEMORY
+  };
+
+  /**
+   * @brief Manages one object (struct) as two EEPROM ENTRIES: a small hot entry holding the frequently changing fields
+   * and a cold entry holding the rest
+   * 
+   * @details The hot fields are declared with EEPROMANAGER_FIELD(T, MEMBER) in ascending OFFSET order and HOT_SIZE is
+   * the sum of their sizes. A change of a hot field rewrites HOT_SIZE bytes instead of the whole struct and wears only
+   * the hot entry, which is relocated on its own once worn out. Both parts are ordinary EEPROManagers, so the registry,
+   * transactions and every other feature handle them individually, while the sketch keeps working with a single T.
+   */
+  template <class T, uint16_t HOT_SIZE> class EEPROManagerSplit
+  {
+    static_assert(HOT_SIZE > 0 && HOT_SIZE < sizeof(T), "EEPROManagerSplit<T, HOT_SIZE> needs hot and cold bytes");
+
+    public:
+      typedef EEPROManagerStaged< EEPROManagerSplitStorage<T, HOT_SIZE> > Hot;
+      typedef EEPROManagerStaged< EEPROManagerSplitStorage<T, sizeof(T) - HOT_SIZE> > Cold;
+
+      EEPROManagerSplit(T *MEMORY, const EEPROManagerField *HOT_FIELDS, uint8_t COUNT, uint16_t HOT_KEY, uint16_t COLD_KEY); // Constructor which binds MEMORY, its hot fields and the KEYS of both EEPROM ENTRIES
+      uint32_t update();                                // Updates whichever EEPROM ENTRIES have changed
+      bool changed();                                   // Returns true if either part differs from its EEPROM ENTRY
+      void synchronise();                               // Synchronises flash based EEPROMs and reads both EEPROM ENTRIES into MEMORY
+      void reload();                                    // Reloads MEMORY from both EEPROM ENTRIES
+      Hot& hot();                                       // Returns the EEPROManager of the hot part
+      Cold& cold();                                     // Returns the EEPROManager of the cold part
+
+    private:
+      Hot _HOT;                                         // Frequently changing fields
+      Cold _COLD;                                       // Everything else
+  };
+
+  /**
+   * @brief Describes one value of an EEPROManagerPacked<BITS>: its first BIT, its WIDTH (1 to 32 bits) and its DEFAULT
+   * 
+   */
+  struct EEPROManagerBits
+  {
+    uint16_t BIT;                                       // First bit of the value within the packed entry
+    uint8_t WIDTH;                                      // Number of bits of the value
+    uint32_t DEFAULT;                                   // Value written when the EEPROM ENTRY is created
+  };
+
+  /**
+   * @brief Holds the packed bits so the defaults are set before the EEPROManager base creates the EEPROM ENTRY
+   * 
+   */
+  template <uint16_t BITS> class EEPROManagerPackedStorage
+  {
+    protected:
+      EEPROManagerPackedStorage(const EEPROManagerBits *VALUES, uint8_t COUNT); // Packs the DEFAULT of every value
+
+      EEPROManagerBytes<(BITS + 7) / 8> _PACKED;        // Packed values, the MEMORY of the EEPROManager base
+  };
+
+  /**
+   * @brief Stores many small settings (flags, levels, modes) bit packed in a single EEPROM ENTRY
+   * 
+   * @details Each value costs its WIDTH in bits instead of the 13 byte header, CRC32 and locate() walk of an EEPROManager
+   * of its own. set() only changes RAM, update() writes the entry once for any number of changed values.
+   * 
+   *   const EEPROManagerBits WIFI_ENABLED = {0, 1, 1};
+   *   const EEPROManagerBits BRIGHTNESS = {1, 4, 8};
+   *   EEPROManagerPacked<5> flags(0x0020);
+   */
+  template <uint16_t BITS> class EEPROManagerPacked : private EEPROManagerPackedStorage<BITS>, public EEPROManager< EEPROManagerBytes<(BITS + 7) / 8> >
+  {
+    public:
+      EEPROManagerPacked(uint16_t KEY = 0x0001, const EEPROManagerBits *VALUES = 0, uint8_t COUNT = 0); // Constructor which sets the EEPROM ENTRY unique KEY and the DEFAULT of every value
+      uint32_t get(const EEPROManagerBits &VALUE) const; // Returns a value
+      void set(const EEPROManagerBits &VALUE, uint32_t DATA); // Sets a value, truncated to its WIDTH
+      bool flag(uint16_t BIT) const;                    // Returns a single bit
+      void flag(uint16_t BIT, bool STATE);              // Sets a single bit
+  };
+
+  /**
+   * @brief Stores values whose size is only known at runtime (strings, blobs) as EEPROM ENTRIES of the usual format
+   * 
+   * @details Every value is an EEPROM ENTRY with its own KEY, WRITE_COUNT and CRC32. A value keeping its length is
+   * rewritten in place, a value changing its length (or worn out) is appended as a new EEPROM ENTRY and the old one is
+   * retired afterwards, so a reset in between leaves the old value. KEYS used with the store must not also be used by an
+   * EEPROManager: put() and remove() refuse them, as well as EEPROMANAGER_JOURNAL_KEY and 0xFFFF. get() verifies the
+   * CRC32, so a value whose in-place rewrite was interrupted by a reset reads back as missing rather than torn. Writes
+   * pay the EEPROManagerBudget at priority 0, so put() returns 0 while the budget is exhausted.
+   */
+  class EEPROManagerStore
+  {
+    public:
+      uint16_t begin();                                 // Indexes the live EEPROM ENTRIES, returns the number indexed
+      uint32_t put(uint16_t KEY, const void *DATA, uint16_t LENGTH); // Writes a value if it differs from the EEPROM ENTRY
+      uint16_t get(uint16_t KEY, void *BUFFER, uint16_t SIZE); // Copies up to SIZE bytes of a value, returns its LENGTH
+      uint16_t length(uint16_t KEY);                    // Returns the LENGTH of a value, 0 if there is none
+      bool remove(uint16_t KEY);                        // Retires the EEPROM ENTRY of a value
+
+    private:
+      static const uint16_t EMPTY = 0xFFFF;             // ADDRESS of a slot which was never used
+      static const uint16_t REMOVED = 0xFFFE;           // ADDRESS of a slot whose value was removed
+
+      struct Slot
+      {
+        uint16_t KEY;                                   // Unique KEY of the EEPROM ENTRY
+        uint16_t ADDRESS;                               // ADDRESS of the EEPROM ENTRY, EMPTY or REMOVED
+      };
+
+      uint16_t lookup(uint16_t KEY, uint16_t &LENGTH);  // Returns the ADDRESS of the live EEPROM ENTRY with KEY
+      bool index(uint16_t KEY, uint16_t ADDRESS);       // Records the ADDRESS of KEY in the hash index
+      static bool owned(uint16_t KEY);                  // Returns true if an EEPROManager manages KEY
+      static bool reserved(uint16_t KEY);               // Returns true if KEY is the journal, erased or an EEPROManager KEY
+      uint16_t tail();                                  // Returns the end of the EEPROM ENTRY chain
+      static void write(uint16_t ADDRESS, const uint8_t *DATA, uint16_t LENGTH); // Writes the bytes which differ from the EEPROM
+
+      Slot _SLOTS[EEPROMANAGER_STORE_SLOTS];            // Open addressed hash index of KEY to ADDRESS
+      uint16_t _END = 0;                                // End of the EEPROM ENTRY chain when last seen
+      bool _BEGUN = false;                              // The index has been built
+      bool _OVERFLOW = false;                           // Entries did not fit into the index, misses walk the chain
+  };
+
+#endif
+
+/**
+ * @brief Construct a new EEPROManager<T>::EEPROManager object
+ * 
+ * @tparam T Object (struct) to manage
+ * @param MEMORY Pointer to object (struct) to manager
+ * @param KEY Unique identifier key for entry location in EEPROM, not EEPROMANAGER_JOURNAL_KEY or 0xFFFF which are
+ * refused: MEMORY is then never loaded or written and update() returns 0xFFFFFFFF
+ */
+template <class T> EEPROManager<T>::EEPROManager(T *MEMORY, uint16_t KEY)
+{
+  _MEMORY = MEMORY;
+  _ENTRY_KEY = KEY;
+  #if !defined(BOARD_RP2040) || !defined(BOARD_ESP)
+  begin();
+  #endif
+}
+
+/**
+ * @brief Synchronise settings for flash based EEPROMs
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::synchronise()
+{
+  #ifdef BOARD_RP2040
+  EEPROM.begin(4096);
+  begin();
+  #endif
+  #ifdef BOARD_ESP
+  EEPROM.begin(512);
+  begin();
+  #endif
+}
+
+/**
+ * @brief Resets the EEPROM by overwriting the values with 0xFF
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::reset()
+{
+  for (uint16_t i = 0 ; i < EEPROM.length() ; i++)
+  {
+    #ifndef BOARD_ESP
+    EEPROM.update(i, 0xFF);
+    #endif
+    #ifdef BOARD_ESP
+    byte currentByte = EEPROM.read(i);
+    if (currentByte != 0xFF)
+    {
+      EEPROM.write(i, 0xFF);
+    }
+    #endif
+  }
+  #if defined(BOARD_RP2040) || defined(BOARD_ESP)
+  EEPROM.commit();
+  #endif
+  begin();
+}
+
+/**
+ * @brief Prints the EEPROM dump to the assigned stream for printing and debugging
+ * 
+ * @tparam T Object (struct) to manage
+ * @param dump string literal hold dump
+ */
+template <class T> void EEPROManager<T>::print(Stream* stream)
+{
+  // Format a row at a time instead of calling printf for every byte
+  static const char hex[] = "0123456789ABCDEF";
+  char row[3 * 32];
+  uint8_t column = 0;
+  for (uint16_t i=0; i<EEPROM.length(); i++)
+  {
+    uint8_t value = EEPROM.read(i);
+    row[column++] = hex[value >> 4];
+    row[column++] = hex[value & 0x0F];
+    row[column++] = ' ';
+    if (column == sizeof(row))
+    {
+      stream->write(static_cast<const uint8_t*>(static_cast<const void*>(row)), column);
+      column = 0;
+    }
+  }
+  stream->write(static_cast<const uint8_t*>(static_cast<const void*>(row)), column);
+  stream->printf("\n");
+  if (_DEBOUNCE)
+  {
+    stream->printf("KEY %04X: %lu ms debounce, %lu writes avoided\n", _ENTRY_KEY, static_cast<unsigned long>(_DEBOUNCE->delay()),
+      static_cast<unsigned long>(_DEBOUNCE->avoided()));
+  }
+  #ifdef EEPROMANAGER_STATS
+  stream->printf("KEY %04X: %lu updates, %lu unchanged, %lu commits, %lu relocations, %lu locate steps\n",
+    _ENTRY_KEY, static_cast<unsigned long>(_STATS.UPDATE_CALLS), static_cast<unsigned long>(_STATS.UNCHANGED),
+    static_cast<unsigned long>(_STATS.COMMITS), static_cast<unsigned long>(_STATS.RELOCATIONS),
+    static_cast<unsigned long>(_STATS.LOCATE_STEPS));
+  stream->printf("KEY %04X: %lu CRC bytes, %lu bytes read, %lu bytes written\n",
+    _ENTRY_KEY, static_cast<unsigned long>(_STATS.CRC_BYTES), static_cast<unsigned long>(_STATS.BYTES_READ),
+    static_cast<unsigned long>(_STATS.BYTES_WRITTEN));
+  stream->printf("KEY %04X: %lu us CRC, %lu us locate, %lu us read, %lu us write, %lu us commit\n",
+    _ENTRY_KEY, static_cast<unsigned long>(_STATS.CRC_MICROS), static_cast<unsigned long>(_STATS.LOCATE_MICROS),
+    static_cast<unsigned long>(_STATS.READ_MICROS), static_cast<unsigned long>(_STATS.WRITE_MICROS),
+    static_cast<unsigned long>(_STATS.COMMIT_MICROS));
+  #endif
+  #ifdef EEPROMANAGER_HISTOGRAMS
+  stream->printf("KEY %04X latency (us):\n", _ENTRY_KEY);
+  _LATENCY.UPDATE.print(stream, "update");
+  _LATENCY.WRITE.print(stream, "write");
+  _LATENCY.COMMIT.print(stream, "commit");
+  _LATENCY.BEGIN.print(stream, "begin");
+  #endif
+  #ifdef EEPROMANAGER_PROFILE
+  stream->printf("KEY %04X field changes over %lu writes (%lu with changes outside the fields):\n", _ENTRY_KEY,
+    static_cast<unsigned long>(_PROFILE_WRITES), static_cast<unsigned long>(_PROFILE_UNMAPPED));
+  for (uint8_t i = 0; i < _FIELD_COUNT; i++)
+  {
+    uint8_t share = _PROFILE_WRITES ? (100 * _FIELDS[i].CHANGES) / _PROFILE_WRITES : 0;
+    stream->printf("  %-16s @%-4u %4u bytes %8lu changes %3u%%%s\n", _FIELDS[i].NAME, _FIELDS[i].OFFSET, _FIELDS[i].SIZE,
+      static_cast<unsigned long>(_FIELDS[i].CHANGES), share, share >= 50 ? " HOT" : (_FIELDS[i].CHANGES ? "" : " COLD"));
+  }
+  #endif
+}
+
+/**
+ * @brief Dumps the EEPROM to the assigned stream as CRC protected binary frames
+ * 
+ * @details Roughly a third of the bytes of print() for a full dump, erased space is sent as FILL frames and LIVE_ONLY
+ * limits the dump to the EEPROM ENTRY chain. Decode with extras/tools/eepromanager_decode.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param stream Stream to dump to
+ * @param LIVE_ONLY Only send live EEPROM ENTRIES (headers of retired entries are kept to preserve the chain)
+ * @return uint16_t Number of frames sent
+ */
+template <class T> uint16_t EEPROManager<T>::dump(Stream* stream, bool LIVE_ONLY)
+{
+  return EEPROManagerFrame::dump(stream, LIVE_ONLY);
+}
+
+/**
+ * @brief Writes a framed image or set of entries from the assigned stream into the EEPROM
+ * 
+ * @details Accepts the frames produced by dump() or by extras/tools/eepromanager_encode. All writes share a single
+ * commit and every EEPROManager is reloaded afterwards. The stream timeout (Stream::setTimeout()) bounds the wait for
+ * each frame.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param stream Stream to read frames from
+ * @return uint8_t EEPROManagerFrame::IMPORT_OK or the reason the import stopped
+ */
+template <class T> uint8_t EEPROManager<T>::import(Stream* stream)
+{
+  return EEPROManagerFrame::import(stream);
+}
+
+/**
+ * @brief Reports the KEY, WRITE_COUNT, LENGTH and stored CRC32 of every live EEPROM ENTRY as framed binary
+ * 
+ * @details A host compares the report to the desired configuration (extras/tools/eepromanager_sync) and sends back
+ * ENTRY frames for the differing entries only, which import() applies with a single commit.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param stream Stream to report to
+ * @return uint16_t Number of frames sent
+ */
+template <class T> uint16_t EEPROManager<T>::report(Stream* stream)
+{
+  return EEPROManagerFrame::report(stream);
+}
+
+/**
+ * @brief Reloads MEMORY from the EEPROM ENTRY, writing MEMORY if no EEPROM ENTRY exists
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::reload()
+{
+  _ADDRESS = 0;
+  begin();
+}
+
+/**
+ * @brief Returns the unique KEY of the EEPROM ENTRY
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint16_t Unique KEY
+ */
+template <class T> uint16_t EEPROManager<T>::key() const
+{
+  return _ENTRY_KEY;
+}
+
+/**
+ * @brief Excludes runtime-only fields (timestamps, caches, pointers) of MEMORY from change detection
+ * 
+ * @details update() then neither writes nor hashes MEMORY because an excluded field changed. Excluded fields are
+ * still written along with the other fields and the stored CRC32 still covers the whole EEPROM ENTRY, so images and
+ * tools are unaffected. The descriptors are referenced, not copied, and must be in ascending OFFSET order.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param FIELDS Array of field descriptors declared with EEPROMANAGER_FIELD(T, MEMBER), or 0 to exclude nothing
+ * @param COUNT Number of descriptors in FIELDS
+ */
+template <class T> void EEPROManager<T>::exclude(const EEPROManagerField *FIELDS, uint8_t COUNT)
+{
+  _EXCLUDED = FIELDS;
+  _EXCLUDED_COUNT = FIELDS ? COUNT : 0;
+  refresh();
+}
+
+/**
+ * @brief Binds significance thresholds so small drifts of numeric fields do not cause writes
+ * 
+ * @details Toleranced fields are left out of the CRC32 used for change detection and compared with their value in
+ * the EEPROM ENTRY instead, so a value creeping in small steps is written once it has moved far enough from the
+ * persisted copy. The descriptors are referenced, not copied, and must be in ascending OFFSET order.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param TOLERANCES Array of thresholds declared with EEPROMANAGER_TOLERANCE(T, MEMBER, ABSOLUTE, RELATIVE, STEP), or 0
+ * @param COUNT Number of thresholds in TOLERANCES
+ */
+template <class T> void EEPROManager<T>::tolerate(const EEPROManagerTolerance *TOLERANCES, uint8_t COUNT)
+{
+  _TOLERANCES = TOLERANCES;
+  _TOLERANCE_COUNT = TOLERANCES ? COUNT : 0;
+  refresh();
+}
+
+/**
+ * @brief Binds a sequence lock guarding MEMORY
+ * 
+ * @details Once bound, update() copies MEMORY under the lock (retrying while a writer is active) and checksums and
+ * writes the copy, so an ISR or the other core modifying MEMORY can never cause a torn struct to be persisted.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param LOCK Sequence lock used by every writer of MEMORY, or 0 to unbind
+ */
+template <class T> void EEPROManager<T>::seqlock(EEPROManagerSeqLock *LOCK)
+{
+  _SEQLOCK = LOCK;
+}
+
+/**
+ * @brief Binds a queue through which another core persists MEMORY
+ * 
+ * @details Intended for the RP2040: the control loop on core 0 calls publish() after changing MEMORY, which only
+ * copies MEMORY into the queue, while loop1() on core 1 calls service() to checksum, compare and write. The
+ * arduino-pico EEPROM.commit() idles the other core only for the flash erase and program, so core 0 is paused for
+ * that window alone. Call synchronise() (or construct the EEPROManager) before starting core 1.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param QUEUE Queue shared by both cores, or 0 to unbind
+ */
+template <class T> void EEPROManager<T>::offload(EEPROManagerQueue<T> *QUEUE)
+{
+  _QUEUE = QUEUE;
+}
+
+/**
+ * @brief Binds an adaptive write-back delay
+ * 
+ * @details Once bound, update() defers writing a change until MEMORY has stayed unchanged for the delay learnt from
+ * the gaps between recent changes, so a slider or rotary encoder is written once after it settles. Keep calling
+ * update() while a change is deferred.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DEBOUNCE Adaptive delay owned by this EEPROManager, or 0 to unbind
+ */
+template <class T> void EEPROManager<T>::debounce(EEPROManagerDebounce *DEBOUNCE)
+{
+  _DEBOUNCE = DEBOUNCE;
+}
+
+/**
+ * @brief Queues a snapshot of MEMORY for service(), without calculating a CRC or touching the EEPROM
+ * 
+ * @tparam T Object (struct) to manage
+ * @return true The snapshot was queued
+ * @return false The queue is full (or no queue is bound): publish again later
+ */
+template <class T> bool EEPROManager<T>::publish()
+{
+  T *slot = _QUEUE ? _QUEUE->slot() : 0;
+  if (!slot)
+  {
+    return false;
+  }
+  if (_SEQLOCK)
+  {
+    if (!snapshot(*slot))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    memcpy(static_cast<void*>(slot), static_cast<const void*>(_MEMORY), sizeof(T));
+  }
+  _QUEUE->push();
+  return true;
+}
+
+/**
+ * @brief Persists the latest snapshot in the queue, discarding older ones
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint32_t Entry write count, 0 if nothing was queued or unchanged or 0xFFFFFFFF if the EEPROM is full
+ */
+template <class T> uint32_t EEPROManager<T>::service()
+{
+  EEPROMANAGER_LATENCY(UPDATE);
+  uint32_t start = EEPROMANAGER_TRACE_START();
+  if (!_QUEUE || !_QUEUE->front())
+  {
+    return 0;
+  }
+  while (_QUEUE->size() > 1)
+  {
+    // Only the latest state needs persisting: release older snapshots to the producer
+    _QUEUE->pop();
+  }
+  uint32_t writeCount = persist(*_QUEUE->front(), checksum(*_QUEUE->front()), start);
+  _QUEUE->pop();
+  return writeCount;
+}
+
+/**
+ * @brief Takes a consistent copy of MEMORY guarded by the bound sequence lock
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA Receives the copy
+ * @return true DATA holds a consistent copy
+ * @return false Writers kept modifying MEMORY for EEPROMANAGER_SNAPSHOT_RETRIES attempts
+ */
+template <class T> bool EEPROManager<T>::snapshot(T &DATA)
+{
+  for (uint8_t attempt = 0; attempt < EEPROMANAGER_SNAPSHOT_RETRIES; attempt++)
+  {
+    EEPROManagerSeqLock::Sequence sequence = _SEQLOCK->readBegin();
+    memcpy(static_cast<void*>(&DATA), static_cast<const void*>(_MEMORY), sizeof(T));
+    if (!_SEQLOCK->readRetry(sequence))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Binds descriptors of the fields of MEMORY used by reports and field based features
+ * 
+ * @details The descriptors are referenced, not copied, and must outlive the EEPROManager.
+ * 
+ * @tparam T Object (struct) to manage
+ * @param FIELDS Array of field descriptors declared with EEPROMANAGER_FIELD(T, MEMBER)
+ * @param COUNT Number of descriptors in FIELDS
+ */
+template <class T> void EEPROManager<T>::fields(EEPROManagerField *FIELDS, uint8_t COUNT)
+{
+  _FIELDS = FIELDS;
+  _FIELD_COUNT = COUNT;
+}
+
+#ifdef EEPROMANAGER_STATS
+/**
+ * @brief Returns the performance counters collected since construction or the last call to resetStats()
+ * 
+ * @tparam T Object (struct) to manage
+ * @return const EEPROManagerStats& Performance counters
+ */
+template <class T> const EEPROManagerStats& EEPROManager<T>::stats() const
+{
+  return _STATS;
+}
+
+/**
+ * @brief Clears the performance counters
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::resetStats()
+{
+  _STATS = {};
+}
+#endif
+
+#ifdef EEPROMANAGER_HISTOGRAMS
+/**
+ * @brief Returns the latency histograms collected since construction or the last call to resetLatency()
+ * 
+ * @tparam T Object (struct) to manage
+ * @return const EEPROManagerLatency& Latency histograms
+ */
+template <class T> const EEPROManagerLatency& EEPROManager<T>::latency() const
+{
+  return _LATENCY;
+}
+
+/**
+ * @brief Clears the latency histograms
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::resetLatency()
+{
+  _LATENCY = {};
+}
+
+/**
+ * @brief Adds a latency sample to the histogram
+ * 
+ * @param LATENCY Latency in micros
+ */
+inline void EEPROManagerHistogram::record(uint32_t LATENCY)
+{
+  uint8_t bucket = 0;
+  for (uint32_t bound = LATENCY >> 1; bound && bucket < EEPROMANAGER_HISTOGRAM_BUCKETS - 1; bound >>= 1)
+  {
+    bucket++;
+  }
+  if (BUCKETS[bucket] < 0xFFFF)
+  {
+    BUCKETS[bucket]++;
+  }
+  if (LATENCY > MAX)
+  {
+    MAX = LATENCY;
+  }
+}
+
+/**
+ * @brief Returns the number of samples recorded
+ * 
+ * @return uint32_t Sample count
+ */
+inline uint32_t EEPROManagerHistogram::samples() const
+{
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < EEPROMANAGER_HISTOGRAM_BUCKETS; i++)
+  {
+    total += BUCKETS[i];
+  }
+  return total;
+}
+
+/**
+ * @brief Returns the upper bound of the bucket containing the requested percentile
+ * 
+ * @param PERCENT Percentile to look up (0 - 100)
+ * @return uint32_t Exclusive upper bound of the bucket in micros, or MAX for the last bucket
+ */
+inline uint32_t EEPROManagerHistogram::percentile(uint8_t PERCENT) const
+{
+  uint32_t threshold = (samples() * PERCENT + 99) / 100;
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < EEPROMANAGER_HISTOGRAM_BUCKETS - 1; i++)
+  {
+    total += BUCKETS[i];
+    if (total >= threshold && total > 0)
+    {
+      return 2UL << i;
+    }
+  }
+  return MAX;
+}
+
+/**
+ * @brief Prints the non-empty buckets of the histogram to the assigned stream
+ * 
+ * @param stream Stream to print to
+ * @param NAME Label printed in front of the histogram
+ */
+inline void EEPROManagerHistogram::print(Stream* stream, const char* NAME) const
+{
+  stream->printf("  %s: %lu samples, max %lu, p50 <%lu, p99 <%lu\n", NAME, static_cast<unsigned long>(samples()),
+    static_cast<unsigned long>(MAX), static_cast<unsigned long>(percentile(50)), static_cast<unsigned long>(percentile(99)));
+  for (uint8_t i = 0; i < EEPROMANAGER_HISTOGRAM_BUCKETS; i++)
+  {
+    if (BUCKETS[i])
+    {
+      stream->printf("    <%lu: %u\n", 2UL << i, BUCKETS[i]);
+    }
+  }
+}
+#endif
+
+#ifdef EEPROMANAGER_TRACE
+/**
+ * @brief Returns the trace ring shared by all EEPROManagers
+ * 
+ * @return EEPROManagerTrace::Ring& Trace ring
+ */
+inline EEPROManagerTrace::Ring& EEPROManagerTrace::ring()
+{
+  static Ring traceRing = {};
+  return traceRing;
+}
+
+/**
+ * @brief Appends a record to the trace ring, overwriting the oldest record when the ring is full
+ * 
+ * @param RECORD Outcome of an update() call
+ */
+inline void EEPROManagerTrace::record(const EEPROManagerTraceRecord &RECORD)
+{
+  Ring &traceRing = ring();
+  traceRing.RECORDS[traceRing.HEAD] = RECORD;
+  traceRing.HEAD = (traceRing.HEAD + 1) % EEPROMANAGER_TRACE_DEPTH;
+  if (traceRing.COUNT < EEPROMANAGER_TRACE_DEPTH)
+  {
+    traceRing.COUNT++;
+  }
+  else
+  {
+    traceRing.DROPPED++;
+  }
+}
+
+/**
+ * @brief Returns the number of records waiting in the trace ring
+ * 
+ * @return uint16_t Waiting records
+ */
+inline uint16_t EEPROManagerTrace::available()
+{
+  return ring().COUNT;
+}
+
+/**
+ * @brief Removes the oldest record from the trace ring
+ * 
+ * @param RECORD Receives the oldest record
+ * @return true A record was removed
+ * @return false The ring is empty
+ */
+inline bool EEPROManagerTrace::pop(EEPROManagerTraceRecord &RECORD)
+{
+  Ring &traceRing = ring();
+  if (traceRing.COUNT == 0)
+  {
+    return false;
+  }
+  RECORD = traceRing.RECORDS[(traceRing.HEAD + EEPROMANAGER_TRACE_DEPTH - traceRing.COUNT) % EEPROMANAGER_TRACE_DEPTH];
+  traceRing.COUNT--;
+  return true;
+}
+
+/**
+ * @brief Streams and removes all waiting records
+ * 
+ * @details Each record is framed as 0xA5, the record fields little endian in declaration order and a CRC8 over the
+ * record fields so the host can resynchronise on a stream mixed with other output.
+ * 
+ * @param stream Stream to write to
+ * @return uint16_t Number of records streamed
+ */
+inline uint16_t EEPROManagerTrace::stream(Stream* stream)
+{
+  uint16_t streamed = 0;
+  EEPROManagerTraceRecord traceRecord;
+  while (pop(traceRecord))
+  {
+    uint8_t frame[20];
+    uint8_t *field = frame + 1;
+    frame[0] = 0xA5;
+    for (uint8_t i = 0; i < 4; i++) *field++ = traceRecord.TIME >> (8 * i);
+    for (uint8_t i = 0; i < 2; i++) *field++ = traceRecord.KEY >> (8 * i);
+    for (uint8_t i = 0; i < 2; i++) *field++ = traceRecord.LENGTH >> (8 * i);
+    for (uint8_t i = 0; i < 2; i++) *field++ = traceRecord.CHANGED >> (8 * i);
+    for (uint8_t i = 0; i < 4; i++) *field++ = traceRecord.WRITE_COUNT >> (8 * i);
+    for (uint8_t i = 0; i < 4; i++) *field++ = traceRecord.LATENCY >> (8 * i);
+    frame[19] = crc8(frame + 1, 18);
+    stream->write(frame, sizeof(frame));
+    streamed++;
+  }
+  return streamed;
+}
+
+/**
+ * @brief Returns the number of records overwritten before they were read
+ * 
+ * @return uint32_t Dropped records
+ */
+inline uint32_t EEPROManagerTrace::dropped()
+{
+  return ring().DROPPED;
+}
+
+/**
+ * @brief Counts the bytes of DATA which differ from the EEPROM contents at ADDRESS
+ * 
+ * @param ADDRESS EEPROM address to compare against
+ * @param DATA Data about to be written
+ * @param LENGTH Number of bytes to compare
+ * @return uint16_t Number of differing bytes
+ */
+inline uint16_t EEPROManagerTrace::difference(uint16_t ADDRESS, const uint8_t *DATA, uint16_t LENGTH)
+{
+  uint16_t changed = 0;
+  for (uint16_t i = 0; i < LENGTH; i++)
+  {
+    if (EEPROM.read(ADDRESS + i) != DATA[i])
+    {
+      changed++;
+    }
+  }
+  return changed;
+}
+#endif
+
+/**
+ * @brief Full memory barrier between MEMORY accesses and sequence updates
+ * 
+ */
+#ifdef __AVR__
+  #define EEPROMANAGER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+  #define EEPROMANAGER_BARRIER() __sync_synchronize()
+#endif
+
+/**
+ * @brief Returns the next free slot for the producer to fill
+ * 
+ * @tparam T Object (struct) to manage
+ * @return T* Free slot or 0 if the queue is full
+ */
+template <class T> T* EEPROManagerQueue<T>::slot()
+{
+  uint8_t head = _HEAD;
+  if ((head + 1) % (EEPROMANAGER_QUEUE_DEPTH + 1) == _TAIL)
+  {
+    return 0;
+  }
+  return static_cast<T*>(static_cast<void*>(_SLOTS[head]));
+}
+
+/**
+ * @brief Publishes the slot returned by slot() to the consumer
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManagerQueue<T>::push()
+{
+  EEPROMANAGER_BARRIER();
+  _HEAD = (_HEAD + 1) % (EEPROMANAGER_QUEUE_DEPTH + 1);
+}
+
+/**
+ * @brief Returns the oldest queued snapshot
+ * 
+ * @tparam T Object (struct) to manage
+ * @return const T* Oldest snapshot or 0 if the queue is empty
+ */
+template <class T> const T* EEPROManagerQueue<T>::front() const
+{
+  uint8_t tail = _TAIL;
+  if (tail == _HEAD)
+  {
+    return 0;
+  }
+  EEPROMANAGER_BARRIER();
+  return static_cast<const T*>(static_cast<const void*>(_SLOTS[tail]));
+}
+
+/**
+ * @brief Returns the number of queued snapshots
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint8_t Queued snapshots
+ */
+template <class T> uint8_t EEPROManagerQueue<T>::size() const
+{
+  return (_HEAD + EEPROMANAGER_QUEUE_DEPTH + 1 - _TAIL) % (EEPROMANAGER_QUEUE_DEPTH + 1);
+}
+
+/**
+ * @brief Releases the snapshot returned by front() back to the producer
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManagerQueue<T>::pop()
+{
+  EEPROMANAGER_BARRIER();
+  _TAIL = (_TAIL + 1) % (EEPROMANAGER_QUEUE_DEPTH + 1);
+}
+
+/**
+ * @brief Marks MEMORY as being modified, call before changing any member
+ * 
+ */
+inline void EEPROManagerSeqLock::beginWrite()
+{
+  _SEQUENCE = _SEQUENCE + 1;
+  EEPROMANAGER_BARRIER();
+}
+
+/**
+ * @brief Marks the modification of MEMORY as complete
+ * 
+ */
+inline void EEPROManagerSeqLock::endWrite()
+{
+  EEPROMANAGER_BARRIER();
+  _SEQUENCE = _SEQUENCE + 1;
+}
+
+/**
+ * @brief Waits until no modification is in progress and returns the sequence to pass to readRetry()
+ * 
+ * @return EEPROManagerSeqLock::Sequence Current (even) sequence
+ */
+inline EEPROManagerSeqLock::Sequence EEPROManagerSeqLock::readBegin() const
+{
+  Sequence sequence;
+  while ((sequence = _SEQUENCE) & 1)
+  {
+    // Writer active: wait for it to finish
+  }
+  EEPROMANAGER_BARRIER();
+  return sequence;
+}
+
+/**
+ * @brief Returns whether MEMORY was modified since readBegin(), in which case the copy must be discarded
+ * 
+ * @param SEQUENCE Sequence returned by readBegin()
+ * @return true MEMORY was modified, retry
+ * @return false The copy is consistent
+ */
+inline bool EEPROManagerSeqLock::readRetry(Sequence SEQUENCE) const
+{
+  EEPROMANAGER_BARRIER();
+  return _SEQUENCE != SEQUENCE;
+}
+
+/**
+ * @brief Decodes the little endian field from its bytes
+ * 
+ * @param BYTES First byte of the field
+ * @return double Field value
+ */
+inline double EEPROManagerTolerance::value(const uint8_t *BYTES) const
+{
+  if (KIND == FLOATING)
+  {
+    if (SIZE == sizeof(float))
+    {
+      float floatValue;
+      memcpy(&floatValue, BYTES, sizeof(floatValue));
+      return floatValue;
+    }
+    double doubleValue;
+    memcpy(&doubleValue, BYTES, sizeof(doubleValue));
+    return doubleValue;
+  }
+  uint64_t raw = 0;
+  for (uint8_t i = 0; i < SIZE && i < sizeof(raw); i++)
+  {
+    raw |= static_cast<uint64_t>(BYTES[i]) << (8 * i);
+  }
+  if (KIND == SIGNED && SIZE < sizeof(raw) && (raw >> (8 * SIZE - 1)) & 1)
+  {
+    // Sign extend
+    raw |= ~static_cast<uint64_t>(0) << (8 * SIZE);
+  }
+  return KIND == SIGNED ? static_cast<double>(static_cast<int64_t>(raw)) : static_cast<double>(raw);
+}
+
+/**
+ * @brief Checks whether a field moved beyond its threshold
+ * 
+ * @param MEMORY Value in MEMORY
+ * @param PERSISTED Value in the EEPROM ENTRY
+ * @return true The change is significant (or only one value is NaN)
+ * @return false The change is within the threshold
+ */
+inline bool EEPROManagerTolerance::exceeded(double MEMORY, double PERSISTED) const
+{
+  if (MEMORY != MEMORY || PERSISTED != PERSISTED)
+  {
+    // NaN: only a change into or out of NaN counts
+    return (MEMORY != MEMORY) != (PERSISTED != PERSISTED);
+  }
+  if (STEP > 0)
+  {
+    return floor(MEMORY / STEP + 0.5) != floor(PERSISTED / STEP + 0.5);
+  }
+  double threshold = RELATIVE * fabs(PERSISTED);
+  threshold = threshold > ABSOLUTE ? threshold : ABSOLUTE;
+  return fabs(MEMORY - PERSISTED) > threshold;
+}
+
+/**
+ * @brief Construct a new EEPROManagerDebounce object
+ * 
+ * @param MAXIMUM Longest write-back delay in millis, a gap this long between changes ends a burst
+ */
+inline EEPROManagerDebounce::EEPROManagerDebounce(uint32_t MAXIMUM)
+{
+  _MAXIMUM = MAXIMUM;
+}
+
+/**
+ * @brief Records a change event if MEMORY differs from the last one and decides whether to write now
+ * 
+ * @param MEMORY_CRC32 CRC32 of MEMORY, which differs from the EEPROM ENTRY
+ * @param NOW Current millis()
+ * @return true MEMORY has settled: write it
+ * @return false MEMORY is still changing: defer the write
+ */
+inline bool EEPROManagerDebounce::due(uint32_t MEMORY_CRC32, uint32_t NOW)
+{
+  if (!_STARTED || MEMORY_CRC32 != _CRC32)
+  {
+    uint32_t interval = NOW - _LAST_CHANGE;
+    if (_PENDING)
+    {
+      // The previous change is replaced before it reached the EEPROM
+      _AVOIDED++;
+    }
+    if (!_STARTED || interval >= _MAXIMUM)
+    {
+      // First change after a quiet period: write it promptly
+      _INTERVAL = 0;
+    }
+    else
+    {
+      _INTERVAL = _INTERVAL ? (3 * _INTERVAL + interval) / 4 : interval;
+    }
+    _STARTED = true;
+    _PENDING = true;
+    _CRC32 = MEMORY_CRC32;
+    _LAST_CHANGE = NOW;
+  }
+  if (NOW - _LAST_CHANGE < delay())
+  {
+    return false;
+  }
+  _PENDING = false;
+  return true;
+}
+
+/**
+ * @brief Drops the pending change when MEMORY returned to the value in the EEPROM ENTRY before it was written
+ * 
+ * @details The return is recorded as the last change event, so the next change starts its own settle delay and is
+ * not counted as a write avoided.
+ * 
+ * @param MEMORY_CRC32 CRC32 of MEMORY, which matches the EEPROM ENTRY
+ * @param NOW Current millis()
+ */
+inline void EEPROManagerDebounce::settled(uint32_t MEMORY_CRC32, uint32_t NOW)
+{
+  if (!_PENDING)
+  {
+    return;
+  }
+  _PENDING = false;
+  _CRC32 = MEMORY_CRC32;
+  _LAST_CHANGE = NOW;
+}
+
+/**
+ * @brief Returns the current write-back delay
+ * 
+ * @return uint32_t Delay in millis
+ */
+inline uint32_t EEPROManagerDebounce::delay() const
+{
+  return 2 * _INTERVAL < _MAXIMUM ? 2 * _INTERVAL : _MAXIMUM;
+}
+
+/**
+ * @brief Returns the number of changes overwritten by a later change before they were written
+ * 
+ * @return uint32_t Writes avoided
+ */
+inline uint32_t EEPROManagerDebounce::avoided() const
+{
+  return _AVOIDED;
+}
+
+/**
+ * @brief Returns the write budget
+ * 
+ * @return EEPROManagerBudget::Bucket& Token bucket
+ */
+inline EEPROManagerBudget::Bucket& EEPROManagerBudget::bucket()
+{
+  static Bucket writeBucket = {false, 255, 0, 0, 0, 0, 0};
+  return writeBucket;
+}
+
+/**
+ * @brief Enables the write budget, call after synchronise() on flash based boards so EEPROM.length() is known
+ * 
+ * @param LIFETIME_HOURS Target lifetime of the EEPROM in hours
+ * @param BURST Bytes which may be written in one go, 0 for EEPROM.length()
+ * @param CRITICAL Lowest priority() whose writes are never deferred
+ */
+inline void EEPROManagerBudget::begin(uint32_t LIFETIME_HOURS, uint32_t BURST, uint8_t CRITICAL)
+{
+  Bucket &state = bucket();
+  state.LIFETIME = static_cast<uint64_t>(LIFETIME_HOURS ? LIFETIME_HOURS : 1) * 3600000UL;
+  state.CAPACITY = static_cast<int64_t>(BURST ? BURST : EEPROM.length()) * state.LIFETIME;
+  state.TOKENS = state.CAPACITY;
+  state.CRITICAL = CRITICAL;
+  state.LAST = millis();
+  state.ENABLED = true;
+}
+
+/**
+ * @brief Disables the write budget
+ * 
+ */
+inline void EEPROManagerBudget::end()
+{
+  bucket().ENABLED = false;
+}
+
+/**
+ * @brief Adds the tokens earned since the last refill, up to the bucket size
+ * 
+ */
+inline void EEPROManagerBudget::refill()
+{
+  Bucket &state = bucket();
+  uint32_t now = millis();
+  int64_t earned = static_cast<int64_t>(now - state.LAST) * EEPROM.length() * EEPROM_MAX_WRITES;
+  state.LAST = now;
+  state.TOKENS = earned >= state.CAPACITY - state.TOKENS ? state.CAPACITY : state.TOKENS + earned;
+}
+
+/**
+ * @brief Pays for a write from the bucket
+ * 
+ * @param BYTES EEPROM bytes worn by the write
+ * @param PRIORITY priority() of the EEPROManager writing
+ * @return true The write may be made
+ * @return false The budget is exhausted: defer the write
+ */
+inline bool EEPROManagerBudget::spend(uint16_t BYTES, uint8_t PRIORITY)
+{
+  Bucket &state = bucket();
+  if (!state.ENABLED)
+  {
+    return true;
+  }
+  refill();
+  int64_t cost = static_cast<int64_t>(BYTES) * state.LIFETIME;
+  if (state.TOKENS < cost && PRIORITY < state.CRITICAL)
+  {
+    state.DEFERRED++;
+    return false;
+  }
+  state.TOKENS -= cost;
+  return true;
+}
+
+/**
+ * @brief Pays for a write which has to be made regardless of the budget, running the bucket into debt if need be
+ * 
+ * @param BYTES EEPROM bytes worn by the write
+ */
+inline void EEPROManagerBudget::debit(uint32_t BYTES)
+{
+  Bucket &state = bucket();
+  if (!state.ENABLED || BYTES == 0)
+  {
+    return;
+  }
+  refill();
+  state.TOKENS -= static_cast<int64_t>(BYTES) * state.LIFETIME;
+}
+
+/**
+ * @brief Returns the sustainable write rate
+ * 
+ * @return uint32_t Bytes per hour
+ */
+inline uint32_t EEPROManagerBudget::rate()
+{
+  Bucket &state = bucket();
+  return state.ENABLED ? static_cast<uint64_t>(EEPROM.length()) * EEPROM_MAX_WRITES * 3600000UL / state.LIFETIME : 0xFFFFFFFF;
+}
+
+/**
+ * @brief Returns the bytes which can be written without being deferred
+ * 
+ * @return uint32_t Bytes available, 0 while in debt
+ */
+inline uint32_t EEPROManagerBudget::available()
+{
+  Bucket &state = bucket();
+  if (!state.ENABLED)
+  {
+    return 0xFFFFFFFF;
+  }
+  refill();
+  return state.TOKENS > 0 ? state.TOKENS / state.LIFETIME : 0;
+}
+
+/**
+ * @brief Returns the number of writes deferred because the budget was exhausted
+ * 
+ * @return uint32_t Writes deferred
+ */
+inline uint32_t EEPROManagerBudget::deferred()
+{
+  return bucket().DEFERRED;
+}
+
+/**
+ * @brief Construct a new EEPROManagerEncoder object
+ * 
+ * @param BUFFER Staging buffer
+ * @param SIZE Size of the staging buffer
+ */
+inline EEPROManagerEncoder::EEPROManagerEncoder(uint8_t *BUFFER, uint16_t SIZE)
+{
+  _BUFFER = BUFFER;
+  _SIZE = SIZE;
+}
+
+/**
+ * @brief Copies bytes into the staging buffer
+ * 
+ * @param DATA Bytes to copy
+ * @param LENGTH Number of bytes
+ */
+inline void EEPROManagerEncoder::bytes(const void *DATA, uint16_t LENGTH)
+{
+  uint16_t room = _POSITION < _SIZE ? _SIZE - _POSITION : 0;
+  memcpy(_BUFFER + _POSITION, DATA, LENGTH < room ? LENGTH : room);
+  _POSITION += LENGTH;
+}
+
+/**
+ * @brief Encodes a trivially copyable field
+ * 
+ * @tparam V Field type
+ * @param VALUE Field
+ */
+template <class V> void EEPROManagerEncoder::value(const V &VALUE)
+{
+  static_assert(__is_trivially_copyable(V), "value() encodes raw bytes: use string() or a nested layout");
+  bytes(&VALUE, sizeof(V));
+}
+
+/**
+ * @brief Encodes an array of trivially copyable values
+ * 
+ * @tparam V Value type
+ * @param VALUES First value
+ * @param COUNT Number of values
+ */
+template <class V> void EEPROManagerEncoder::array(const V *VALUES, uint16_t COUNT)
+{
+  static_assert(__is_trivially_copyable(V), "array() encodes raw bytes: encode the elements one by one");
+  bytes(VALUES, COUNT * sizeof(V));
+}
+
+/**
+ * @brief Encodes a String as its LENGTH (1) followed by CAPACITY characters, truncating and zero padding
+ * 
+ * @param VALUE String to encode
+ * @param CAPACITY Characters reserved in the EEPROM ENTRY
+ */
+inline void EEPROManagerEncoder::string(const String &VALUE, uint8_t CAPACITY)
+{
+  uint8_t length = VALUE.length() < CAPACITY ? VALUE.length() : CAPACITY;
+  bytes(&length, 1);
+  for (uint8_t i = 0; i < CAPACITY; i++)
+  {
+    // Pad with zeros so unused capacity never changes the CRC32
+    uint8_t character = i < length ? VALUE.charAt(i) : 0;
+    bytes(&character, 1);
+  }
+}
+
+/**
+ * @brief Construct a new EEPROManagerDecoder object
+ * 
+ * @param BUFFER Staging buffer
+ * @param SIZE Size of the staging buffer
+ */
+inline EEPROManagerDecoder::EEPROManagerDecoder(const uint8_t *BUFFER, uint16_t SIZE)
+{
+  _BUFFER = BUFFER;
+  _SIZE = SIZE;
+}
+
+/**
+ * @brief Copies bytes out of the staging buffer, bytes past its end read as zero
+ * 
+ * @param DATA Receives the bytes
+ * @param LENGTH Number of bytes
+ */
+inline void EEPROManagerDecoder::bytes(void *DATA, uint16_t LENGTH)
+{
+  uint16_t room = _POSITION < _SIZE ? _SIZE - _POSITION : 0;
+  uint16_t count = LENGTH < room ? LENGTH : room;
+  memcpy(DATA, _BUFFER + _POSITION, count);
+  memset(static_cast<uint8_t*>(DATA) + count, 0, LENGTH - count);
+  _POSITION += LENGTH;
+}
+
+/**
+ * @brief Decodes a trivially copyable field
+ * 
+ * @tparam V Field type
+ * @param VALUE Receives the field
+ */
+template <class V> void EEPROManagerDecoder::value(V &VALUE)
+{
+  static_assert(__is_trivially_copyable(V), "value() decodes raw bytes: use string() or a nested layout");
+  bytes(&VALUE, sizeof(V));
+}
+
+/**
+ * @brief Decodes an array of trivially copyable values
+ * 
+ * @tparam V Value type
+ * @param VALUES Receives the values
+ * @param COUNT Number of values
+ */
+template <class V> void EEPROManagerDecoder::array(V *VALUES, uint16_t COUNT)
+{
+  static_assert(__is_trivially_copyable(V), "array() decodes raw bytes: decode the elements one by one");
+  bytes(VALUES, COUNT * sizeof(V));
+}
+
+/**
+ * @brief Decodes a String, reserving CAPACITY once so repeated reloads do not reallocate
+ * 
+ * @param VALUE Receives the String
+ * @param CAPACITY Characters reserved in the EEPROM ENTRY
+ */
+inline void EEPROManagerDecoder::string(String &VALUE, uint8_t CAPACITY)
+{
+  uint8_t length = 0;
+  bytes(&length, 1);
+  length = length < CAPACITY ? length : CAPACITY;
+  VALUE.reserve(CAPACITY);
+  VALUE = "";
+  for (uint8_t i = 0; i < CAPACITY; i++)
+  {
+    char character = 0;
+    bytes(&character, 1);
+    if (i < length)
+    {
+      VALUE.concat(character);
+    }
+  }
+}
+
+/**
+ * @brief Adds the EEPROManager to the list of EEPROManagers
+ * 
+ */
+inline EEPROManagerBase::EEPROManagerBase()
+{
+  link();
+}
+
+/**
+ * @brief Removes the EEPROManager from the list of EEPROManagers
+ * 
+ */
+inline EEPROManagerBase::~EEPROManagerBase()
+{
+  unlink();
+}
+
+/**
+ * @brief Inserts the EEPROManager in front of the EEPROManagers with the same or a lower priority
+ * 
+ */
+inline void EEPROManagerBase::link()
+{
+  EEPROManagerBase **link = &head();
+  while (*link && (*link)->_PRIORITY > _PRIORITY)
+  {
+    link = &(*link)->_NEXT;
+  }
+  _NEXT = *link;
+  *link = this;
+}
+
+/**
+ * @brief Removes the EEPROManager from the list, moving the round-robin cursor off it
+ * 
+ */
+inline void EEPROManagerBase::unlink()
+{
+  if (EEPROManagerRegistry::cursor() == this)
+  {
+    EEPROManagerRegistry::cursor() = 0;
+  }
+  for (EEPROManagerBase **link = &head(); *link; link = &(*link)->_NEXT)
+  {
+    if (*link == this)
+    {
+      *link = _NEXT;
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Sets the priority used by EEPROManagerRegistry::updateAll()
+ * 
+ * @param PRIORITY 0 to share the time budget round-robin, higher values are checked on every call, highest first
+ */
+inline void EEPROManagerBase::priority(uint8_t PRIORITY)
+{
+  unlink();
+  _PRIORITY = PRIORITY;
+  link();
+}
+
+/**
+ * @brief Returns the priority of the EEPROManager
+ * 
+ * @return uint8_t Priority
+ */
+inline uint8_t EEPROManagerBase::priority() const
+{
+  return _PRIORITY;
+}
+
+/**
+ * @brief Sets the longest time MEMORY may stay changed before EEPROManagerRegistry::schedule() writes it
+ * 
+ * @param DEADLINE Deadline in millis, 0 to write as soon as a change is found
+ */
+inline void EEPROManagerBase::deadline(uint32_t DEADLINE)
+{
+  _DEADLINE = DEADLINE;
+}
+
+/**
+ * @brief Returns the deadline used by EEPROManagerRegistry::schedule()
+ * 
+ * @return uint32_t Deadline in millis
+ */
+inline uint32_t EEPROManagerBase::deadline() const
+{
+  return _DEADLINE;
+}
+
+/**
+ * @brief Returns the head of the list of EEPROManagers
+ * 
+ * @return EEPROManagerBase*& Head of the list
+ */
+inline EEPROManagerBase*& EEPROManagerBase::head()
+{
+  static EEPROManagerBase *listHead = 0;
+  return listHead;
+}
+
+/**
+ * @brief Returns the first EEPROManager in the list (the most recently constructed of the highest priority)
+ * 
+ * @return EEPROManagerBase* First EEPROManager or 0 if none exist
+ */
+inline EEPROManagerBase* EEPROManagerBase::first()
+{
+  return head();
+}
+
+/**
+ * @brief Returns the next EEPROManager in the list
+ * 
+ * @return EEPROManagerBase* Next EEPROManager or 0 at the end of the list
+ */
+inline EEPROManagerBase* EEPROManagerBase::next() const
+{
+  return _NEXT;
+}
+
+/**
+ * @brief Reloads every EEPROManager from the EEPROM
+ * 
+ */
+inline void EEPROManagerBase::reloadAll()
+{
+  holdCommit();
+  for (EEPROManagerBase *manager = first(); manager; manager = manager->next())
+  {
+    manager->reload();
+  }
+  releaseCommit();
+}
+
+/**
+ * @brief Returns the round-robin cursor
+ * 
+ * @return EEPROManagerBase*& Next EEPROManager of priority 0 to check, 0 to start at the first one
+ */
+inline EEPROManagerBase*& EEPROManagerRegistry::cursor()
+{
+  static EEPROManagerBase *next = 0;
+  return next;
+}
+
+/**
+ * @brief Returns the number of failed writes of the last round
+ * 
+ * @return uint8_t& Failure counter shared by all translation units
+ */
+inline uint8_t& EEPROManagerRegistry::failures()
+{
+  static uint8_t failed = 0;
+  return failed;
+}
+
+/**
+ * @brief Counts the result of an update() as written, or as failed when it found no EEPROM space (0xFFFFFFFF)
+ * 
+ * @param WRITE_COUNT Result of update()
+ * @param WRITTEN Written counter of the round
+ */
+inline void EEPROManagerRegistry::tally(uint32_t WRITE_COUNT, uint8_t &WRITTEN)
+{
+  if (WRITE_COUNT == 0xFFFFFFFF)
+  {
+    failures()++;
+  }
+  else if (WRITE_COUNT)
+  {
+    WRITTEN++;
+  }
+}
+
+/**
+ * @brief Returns the number of EEPROManagers whose write the last updateAll() (or writing schedule()) could not make as
+ * the EEPROM is full
+ * 
+ * @return uint8_t Number of failed writes, 0 if every changed EEPROManager was written
+ */
+inline uint8_t EEPROManagerRegistry::failed()
+{
+  return failures();
+}
+
+/**
+ * @brief Returns the number of registered EEPROManagers
+ * 
+ * @return uint8_t Number of EEPROManagers
+ */
+inline uint8_t EEPROManagerRegistry::count()
+{
+  uint8_t managers = 0;
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->next())
+  {
+    managers++;
+  }
+  return managers;
+}
+
+/**
+ * @brief Checks that no two EEPROManagers share a KEY, which would silently alias their EEPROM ENTRIES
+ * 
+ * @details Hashed KEYS from EEPROManagerKey() or an EEPROManagerNamespace can collide with each other or with literal
+ * KEYS. Call once from setup(), the check compares every pair of EEPROManagers.
+ * 
+ * @param stream Stream to report each colliding KEY to, or 0
+ * @return uint8_t Number of KEYS used by more than one EEPROManager
+ */
+inline uint8_t EEPROManagerRegistry::collisions(Stream* stream)
+{
+  uint8_t colliding = 0;
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->next())
+  {
+    // Each KEY is counted at its first EEPROManager only
+    bool seen = false;
+    for (EEPROManagerBase *earlier = EEPROManagerBase::first(); earlier != manager && !seen; earlier = earlier->next())
+    {
+      seen = earlier->key() == manager->key();
+    }
+    uint8_t users = 1;
+    for (EEPROManagerBase *later = manager->next(); later && !seen; later = later->next())
+    {
+      users += later->key() == manager->key();
+    }
+    if (!seen && users > 1)
+    {
+      colliding++;
+      if (stream)
+      {
+        stream->printf("KEY %04X is used by %u EEPROManagers\n", manager->key(), users);
+      }
+    }
+  }
+  return colliding;
+}
+
+/**
+ * @brief Updates the prioritised EEPROManagers, then the others round-robin for up to BUDGET micros, with one commit
+ * 
+ * @param BUDGET Time budget in micros for the round-robin EEPROManagers, the default checks all of them
+ * @return uint8_t Number of EEPROM ENTRIES written, writes which found no EEPROM space are counted by failed() instead
+ */
+inline uint8_t EEPROManagerRegistry::updateAll(uint32_t BUDGET)
+{
+  uint32_t start = micros();
+  uint8_t written = 0;
+  failures() = 0;
+  EEPROManagerBase::holdCommit();
+  EEPROManagerBase *manager = EEPROManagerBase::first();
+  for (; manager && manager->_PRIORITY; manager = manager->_NEXT)
+  {
+    tally(manager->update(), written);
+  }
+  if (manager)
+  {
+    // manager is the first of priority 0: continue the round from the cursor, wrapping back to it
+    EEPROManagerBase *&next = cursor();
+    next = next ? next : manager;
+    EEPROManagerBase *stop = next;
+    do
+    {
+      tally(next->update(), written);
+      next = next->_NEXT ? next->_NEXT : manager;
+    } while (next != stop && micros() - start < BUDGET);
+  }
+  EEPROManagerBase::releaseCommit();
+  return written;
+}
+
+/**
+ * @brief Checks every EEPROManager for changes and writes them when the earliest deadline falls due
+ * 
+ * @details Every changed EEPROManager whose deadline expires within WINDOW millis of the earliest one is written in
+ * the same commit, so one commit is spent per window instead of one per EEPROManager. An EEPROManager stays pending,
+ * with its original deadline, until a write actually succeeds: a write deferred by a debounce or the write budget is
+ * retried on every following call. The CRC32 calculated while checking for changes is reused for the write.
+ * 
+ * @param WINDOW Commit window in millis
+ * @return uint8_t Number of EEPROM ENTRIES written
+ */
+inline uint8_t EEPROManagerRegistry::schedule(uint32_t WINDOW)
+{
+  uint32_t now = millis();
+  uint32_t earliest = 0xFFFFFFFF;
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->_NEXT)
+  {
+    if (!manager->changed())
+    {
+      // Changed back (or written elsewhere): nothing is pending any more
+      manager->_DIRTY = false;
+      continue;
+    }
+    if (!manager->_DIRTY)
+    {
+      manager->_DIRTY = true;
+      manager->_DIRTY_SINCE = now;
+    }
+    uint32_t remaining = now - manager->_DIRTY_SINCE < manager->_DEADLINE ? manager->_DEADLINE - (now - manager->_DIRTY_SINCE) : 0;
+    earliest = remaining < earliest ? remaining : earliest;
+  }
+  if (earliest != 0)
+  {
+    // Nothing due yet (or nothing changed)
+    return 0;
+  }
+  uint8_t written = 0;
+  failures() = 0;
+  EEPROManagerBase::holdCommit();
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->_NEXT)
+  {
+    if (manager->_DIRTY && now - manager->_DIRTY_SINCE + WINDOW >= manager->_DEADLINE)
+    {
+      uint32_t writeCount = manager->flush();
+      tally(writeCount, written);
+      manager->_DIRTY = writeCount == 0 || writeCount == 0xFFFFFFFF;
+    }
+  }
+  EEPROManagerBase::releaseCommit();
+  return written;
+}
+
+/**
+ * @brief Returns the commit batching state
+ * 
+ * @return EEPROManagerBase::CommitState& Commit batching state
+ */
+inline EEPROManagerBase::CommitState& EEPROManagerBase::commitState()
+{
+  static CommitState state = {0, false};
+  return state;
+}
+
+/**
+ * @brief Defers EEPROM commits until the matching releaseCommit(), calls may be nested
+ * 
+ */
+inline void EEPROManagerBase::holdCommit()
+{
+  commitState().HOLD++;
+}
+
+/**
+ * @brief Ends a holdCommit() and commits once if any commit was deferred by the outermost hold
+ * 
+ */
+inline void EEPROManagerBase::releaseCommit()
+{
+  CommitState &state = commitState();
+  if (state.HOLD && --state.HOLD == 0 && state.PENDING)
+  {
+    state.PENDING = false;
+    #if defined(BOARD_RP2040) || defined(BOARD_ESP)
+    EEPROM.commit();
+    #endif
+  }
+}
+
+/**
+ * @brief Commits the EEPROM now, or at the outermost releaseCommit() while commits are held
+ * 
+ */
+inline void EEPROManagerBase::requestCommit()
+{
+  if (!commitHeld())
+  {
+    #if defined(BOARD_RP2040) || defined(BOARD_ESP)
+    EEPROM.commit();
+    #endif
+  }
+}
+
+/**
+ * @brief Returns whether commits are currently held, recording that a commit was deferred
+ * 
+ * @return true The commit must be deferred
+ * @return false The commit may be performed now
+ */
+inline bool EEPROManagerBase::commitHeld()
+{
+  CommitState &state = commitState();
+  if (state.HOLD)
+  {
+    state.PENDING = true;
+  }
+  return state.HOLD;
+}
+
+/**
+ * @brief Reads and validates the EEPROM ENTRY header at ADDRESS
+ * 
+ * @details Used to walk the EEPROM ENTRY chain the same way locate() does: the next header follows at
+ * ADDRESS + 13 + LENGTH.
+ * 
+ * @param ADDRESS EEPROM address of the header
+ * @param KEY Receives the KEY of the EEPROM ENTRY
+ * @param WRITE_COUNT Receives the WRITE_COUNT of the EEPROM ENTRY
+ * @param LENGTH Receives the LENGTH of the EEPROM ENTRY data
+ * @return true A valid header was read
+ * @return false ADDRESS holds uninitialised space or lies past the end of the EEPROM
+ */
+inline bool EEPROManagerBase::header(uint32_t ADDRESS, uint16_t &KEY, uint32_t &WRITE_COUNT, uint16_t &LENGTH)
+{
+  uint8_t keyCRC8 = 0;
+  if (ADDRESS + 9 > EEPROM.length())
+  {
+    return false;
+  }
+  EEPROM.get(ADDRESS, KEY);
+  EEPROM.get(ADDRESS + 2, keyCRC8);
+  if (crc8(static_cast<uint8_t*>(static_cast<void*>(&KEY)), sizeof(uint8_t)) != keyCRC8)
+  {
+    return false;
+  }
+  EEPROM.get(ADDRESS + 3, WRITE_COUNT);
+  EEPROM.get(ADDRESS + 7, LENGTH);
+  return true;
+}
+
+/**
+ * @brief Walks the EEPROM ENTRY chain for the live EEPROM ENTRY with KEY
+ * 
+ * @param KEY Unique KEY to look for
+ * @param LENGTH Receives the LENGTH of the EEPROM ENTRY data
+ * @return uint16_t ADDRESS of the EEPROM ENTRY or 0xFFFF if there is none
+ */
+inline uint16_t EEPROManagerBase::find(uint16_t KEY, uint16_t &LENGTH)
+{
+  uint16_t entryKey = 0;
+  uint32_t writeCount = 0;
+  for (uint32_t address = 0; header(address, entryKey, writeCount, LENGTH); address += 9 + LENGTH + 4)
+  {
+    if (entryKey == KEY && writeCount < EEPROM_MAX_WRITES)
+    {
+      return address;
+    }
+  }
+  return 0xFFFF;
+}
+
+/**
+ * @brief Walks the EEPROM ENTRY chain to its end, where the next EEPROM ENTRY will be written
+ * 
+ * @return uint16_t ADDRESS of the first byte of uninitialised space
+ */
+inline uint16_t EEPROManagerBase::end()
+{
+  uint16_t entryKey = 0;
+  uint32_t writeCount = 0;
+  uint16_t length = 0;
+  uint32_t address = 0;
+  while (header(address, entryKey, writeCount, length))
+  {
+    address += 9 + length + 4;
+  }
+  return address < EEPROM.length() ? address : EEPROM.length();
+}
+
+/**
+ * @brief Calculates the CRC32 of an EEPROM region
+ * 
+ * @details Hashes in small chunks, continuing the CRC32 between them, so no buffer the size of the region is needed.
+ * 
+ * @param ADDRESS First EEPROM address of the region
+ * @param LENGTH Number of bytes in the region
+ * @return uint32_t CRC32 identical to crc32() over the whole region
+ */
+inline uint32_t EEPROManagerBase::checksum(uint16_t ADDRESS, uint16_t LENGTH)
+{
+  uint32_t regionCRC32 = 0;
+  uint8_t chunk[32];
+  while (LENGTH)
+  {
+    uint8_t count = LENGTH < sizeof(chunk) ? LENGTH : sizeof(chunk);
+    for (uint8_t i = 0; i < count; i++)
+    {
+      chunk[i] = EEPROM.read(ADDRESS + i);
+    }
+    regionCRC32 = crc32(chunk, count, 0x04C11DB7, regionCRC32);
+    ADDRESS += count;
+    LENGTH -= count;
+  }
+  return regionCRC32;
+}
+
+/**
+ * @brief Checks whether KEY is reserved and cannot be the KEY of an EEPROManager
+ * 
+ * @param KEY Unique KEY of an EEPROM ENTRY
+ * @return true KEY is EEPROMANAGER_JOURNAL_KEY or 0xFFFF, the KEY of erased EEPROM
+ * @return false KEY may be used
+ */
+inline bool EEPROManagerBase::reserved(uint16_t KEY)
+{
+  return KEY == EEPROMANAGER_JOURNAL_KEY || KEY == 0xFFFF;
+}
+
+/**
+ * @brief Sends a single frame
+ * 
+ * @param stream Stream to send to
+ * @param TYPE Frame type
+ * @param ADDRESS EEPROM address the frame refers to
+ * @param PAYLOAD Payload bytes
+ * @param LENGTH Number of payload bytes (at most EEPROMANAGER_FRAME_CHUNK)
+ */
+inline void EEPROManagerFrame::send(Stream* stream, uint8_t TYPE, uint16_t ADDRESS, const uint8_t *PAYLOAD, uint8_t LENGTH)
+{
+  uint8_t frame[1 + 4 + EEPROMANAGER_FRAME_CHUNK + 4];
+  frame[0] = SYNC;
+  frame[1] = TYPE;
+  frame[2] = ADDRESS;
+  frame[3] = ADDRESS >> 8;
+  frame[4] = LENGTH;
+  memcpy(frame + 5, PAYLOAD, LENGTH);
+  uint32_t frameCRC32 = crc32(frame + 1, 4 + LENGTH);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    frame[5 + LENGTH + i] = frameCRC32 >> (8 * i);
+  }
+  stream->write(frame, 9 + LENGTH);
+}
+
+/**
+ * @brief Sends an EEPROM region as DATA frames, with erased runs of a whole chunk or more sent as FILL frames
+ * 
+ * @param stream Stream to send to
+ * @param ADDRESS First EEPROM address of the region
+ * @param LENGTH Number of bytes in the region
+ * @return uint16_t Number of frames sent
+ */
+inline uint16_t EEPROManagerFrame::region(Stream* stream, uint16_t ADDRESS, uint16_t LENGTH)
+{
+  uint16_t frames = 0;
+  uint16_t end = ADDRESS + LENGTH;
+  uint8_t chunk[EEPROMANAGER_FRAME_CHUNK];
+  while (ADDRESS < end)
+  {
+    uint16_t run = 0;
+    while (ADDRESS + run < end && EEPROM.read(ADDRESS + run) == 0xFF)
+    {
+      run++;
+    }
+    if (run >= EEPROMANAGER_FRAME_CHUNK || ADDRESS + run == end)
+    {
+      uint8_t fill[3] = {static_cast<uint8_t>(run), static_cast<uint8_t>(run >> 8), 0xFF};
+      send(stream, FILL, ADDRESS, fill, sizeof(fill));
+      ADDRESS += run;
+    }
+    else
+    {
+      uint8_t length = 0;
+      while (length < EEPROMANAGER_FRAME_CHUNK && ADDRESS + length < end)
+      {
+        chunk[length] = EEPROM.read(ADDRESS + length);
+        length++;
+      }
+      send(stream, DATA, ADDRESS, chunk, length);
+      ADDRESS += length;
+    }
+    frames++;
+  }
+  return frames;
+}
+
+/**
+ * @brief Sends the EEPROM as a framed dump
+ * 
+ * @param stream Stream to send to
+ * @param LIVE_ONLY Only send the EEPROM ENTRY chain, skipping the data of retired entries and the erased space after it
+ * @return uint16_t Number of frames sent
+ */
+inline uint16_t EEPROManagerFrame::dump(Stream* stream, bool LIVE_ONLY)
+{
+  uint16_t frames = 1;
+  uint8_t header[3] = {static_cast<uint8_t>(EEPROM.length()), static_cast<uint8_t>(EEPROM.length() >> 8), static_cast<uint8_t>(LIVE_ONLY ? EEPROManagerFrame::LIVE_ONLY : 0)};
+  send(stream, HEADER, 0, header, sizeof(header));
+  if (LIVE_ONLY)
+  {
+    uint16_t key = 0;
+    uint32_t writeCount = 0;
+    uint16_t length = 0;
+    for (uint32_t address = 0; EEPROManagerBase::header(address, key, writeCount, length); address += 9 + length + 4)
+    {
+      uint32_t entryLength = 9 + length + 4;
+      if (address + entryLength > EEPROM.length())
+      {
+        entryLength = EEPROM.length() - address;
+      }
+      frames += region(stream, address, writeCount < EEPROM_MAX_WRITES ? entryLength : 9);
+    }
+  }
+  else
+  {
+    frames += region(stream, 0, EEPROM.length());
+  }
+  frames++;
+  uint8_t trailer[2] = {static_cast<uint8_t>(frames), static_cast<uint8_t>(frames >> 8)};
+  send(stream, END, 0, trailer, sizeof(trailer));
+  return frames;
+}
+
+/**
+ * @brief Sends a REPORT frame for every live EEPROM ENTRY followed by an END frame
+ * 
+ * @param stream Stream to send to
+ * @return uint16_t Number of frames sent
+ */
+inline uint16_t EEPROManagerFrame::report(Stream* stream)
+{
+  uint16_t frames = 0;
+  uint16_t key = 0;
+  uint32_t writeCount = 0;
+  uint16_t length = 0;
+  for (uint32_t address = 0; EEPROManagerBase::header(address, key, writeCount, length); address += 9 + length + 4)
+  {
+    if (writeCount >= EEPROM_MAX_WRITES || address + 9 + length + 4 > EEPROM.length())
+    {
+      continue;
+    }
+    uint32_t entryCRC32 = 0;
+    EEPROM.get(address + 9 + length, entryCRC32);
+    uint8_t payload[10];
+    for (uint8_t i = 0; i < 4; i++) payload[i] = writeCount >> (8 * i);
+    for (uint8_t i = 0; i < 2; i++) payload[4 + i] = length >> (8 * i);
+    for (uint8_t i = 0; i < 4; i++) payload[6 + i] = entryCRC32 >> (8 * i);
+    send(stream, REPORT, key, payload, sizeof(payload));
+    frames++;
+  }
+  frames++;
+  uint8_t trailer[2] = {static_cast<uint8_t>(frames), static_cast<uint8_t>(frames >> 8)};
+  send(stream, END, 0, trailer, sizeof(trailer));
+  return frames;
+}
+
+/**
+ * @brief Writes a byte if it differs from the EEPROM, sparing EEPROM cells and flash pages
+ * 
+ * @param ADDRESS EEPROM address
+ * @param VALUE Byte to write
+ * @return true The byte was written
+ * @return false The EEPROM already held VALUE
+ */
+inline bool EEPROManagerFrame::store(uint16_t ADDRESS, uint8_t VALUE)
+{
+  if (EEPROM.read(ADDRESS) == VALUE)
+  {
+    return false;
+  }
+  EEPROM.write(ADDRESS, VALUE);
+  return true;
+}
+
+/**
+ * @brief Receives a single frame, skipping any bytes before the SYNC byte
+ * 
+ * @param stream Stream to read from
+ * @param TYPE Receives the frame type
+ * @param ADDRESS Receives the frame ADDRESS
+ * @param PAYLOAD Receives the payload, at least EEPROMANAGER_FRAME_CHUNK bytes
+ * @param LENGTH Receives the number of payload bytes
+ * @return uint8_t IMPORT_OK, IMPORT_TIMEOUT or IMPORT_CORRUPT
+ */
+inline uint8_t EEPROManagerFrame::receive(Stream* stream, uint8_t &TYPE, uint16_t &ADDRESS, uint8_t *PAYLOAD, uint8_t &LENGTH)
+{
+  uint8_t frame[4 + EEPROMANAGER_FRAME_CHUNK + 4];
+  do
+  {
+    if (stream->readBytes(frame, 1) != 1)
+    {
+      return IMPORT_TIMEOUT;
+    }
+  } while (frame[0] != SYNC);
+  if (stream->readBytes(frame, 4) != 4)
+  {
+    return IMPORT_TIMEOUT;
+  }
+  LENGTH = frame[3];
+  if (LENGTH > EEPROMANAGER_FRAME_CHUNK)
+  {
+    return IMPORT_CORRUPT;
+  }
+  if (stream->readBytes(frame + 4, LENGTH + 4) != static_cast<size_t>(LENGTH + 4))
+  {
+    return IMPORT_TIMEOUT;
+  }
+  uint32_t frameCRC32 = 0;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    frameCRC32 |= static_cast<uint32_t>(frame[4 + LENGTH + i]) << (8 * i);
+  }
+  if (crc32(frame, 4 + LENGTH) != frameCRC32)
+  {
+    return IMPORT_CORRUPT;
+  }
+  TYPE = frame[0];
+  ADDRESS = frame[1] | (frame[2] << 8);
+  memcpy(PAYLOAD, frame + 4, LENGTH);
+  return IMPORT_OK;
+}
+
+/**
+ * @brief Applies a framed image (HEADER, DATA, FILL, END) or set of entries (ENTRY, END) and reloads all EEPROManagers
+ * 
+ * @details Patched EEPROM ENTRIES get a new CRC32 and WRITE_COUNT only once a valid END frame has been received. If
+ * the import stops early (timeout, corrupt frame, size or count mismatch) the patched EEPROM ENTRIES are retired
+ * instead of sealed, so no half-patched data ever reads back as valid: every EEPROManager then rewrites its MEMORY,
+ * which still holds the data from before the import, into fresh space, while patched entries without an EEPROManager
+ * are lost and must be imported again. Image frames (DATA, FILL) are written as they arrive, so an interrupted image
+ * import leaves a partial image and must be repeated. Whenever anything was written all writes share a single commit
+ * and every EEPROManager is reloaded, so MEMORY always matches the EEPROM afterwards. The bytes actually changed are
+ * debited from the EEPROManagerBudget, which may run into debt.
+ * 
+ * @param stream Stream to read frames from
+ * @return uint8_t IMPORT_OK or the reason the import stopped
+ */
+inline uint8_t EEPROManagerFrame::import(Stream* stream)
+{
+  uint16_t patched[EEPROMANAGER_IMPORT_ENTRIES];
+  uint16_t patchedLength[EEPROMANAGER_IMPORT_ENTRIES];
+  uint8_t patchedCount = 0;
+  uint16_t frames = 0;
+  uint8_t status = IMPORT_OK;
+  bool complete = false;
+  bool written = false;
+  uint32_t worn = 0;
+  uint8_t payload[EEPROMANAGER_FRAME_CHUNK];
+  EEPROManagerBase::holdCommit();
+  while (status == IMPORT_OK && !complete)
+  {
+    uint8_t type = 0;
+    uint16_t address = 0;
+    uint8_t length = 0;
+    status = receive(stream, type, address, payload, length);
+    if (status != IMPORT_OK)
+    {
+      break;
+    }
+    frames++;
+    switch (type)
+    {
+      case HEADER:
+        if (length < 2 || (payload[0] | (payload[1] << 8)) != EEPROM.length())
+        {
+          status = IMPORT_SIZE;
+        }
+        break;
+      case DATA:
+        if (static_cast<uint32_t>(address) + length > EEPROM.length())
+        {
+          status = IMPORT_SIZE;
+          break;
+        }
+        for (uint8_t i = 0; i < length; i++)
+        {
+          worn += store(address + i, payload[i]);
+        }
+        written = true;
+        break;
+      case FILL:
+      {
+        uint16_t count = length < 3 ? 0 : payload[0] | (payload[1] << 8);
+        if (length < 3 || static_cast<uint32_t>(address) + count > EEPROM.length())
+        {
+          status = IMPORT_SIZE;
+          break;
+        }
+        for (uint16_t i = 0; i < count; i++)
+        {
+          worn += store(address + i, payload[2]);
+        }
+        written = true;
+        break;
+      }
+      case ENTRY:
+      {
+        // ADDRESS holds the KEY: patch the data of the live EEPROM ENTRY
+        uint16_t entryLength = 0;
+        uint16_t entryAddress = EEPROManagerBase::find(address, entryLength);
+        uint16_t offset = length < 2 ? 0 : payload[0] | (payload[1] << 8);
+        if (entryAddress == 0xFFFF)
+        {
+          status = IMPORT_KEY;
+          break;
+        }
+        if (length < 2 || static_cast<uint32_t>(offset) + length - 2 > entryLength)
+        {
+          status = IMPORT_SIZE;
+          break;
+        }
+        uint8_t i = 0;
+        while (i < patchedCount && patched[i] != entryAddress)
+        {
+          i++;
+        }
+        if (i == patchedCount)
+        {
+          if (patchedCount == EEPROMANAGER_IMPORT_ENTRIES)
+          {
+            status = IMPORT_OVERFLOW;
+            break;
+          }
+          patched[patchedCount] = entryAddress;
+          patchedLength[patchedCount++] = entryLength;
+        }
+        for (uint8_t j = 2; j < length; j++)
+        {
+          worn += store(entryAddress + 9 + offset + j - 2, payload[j]);
+        }
+        written = true;
+        break;
+      }
+      case END:
+        complete = true;
+        if (length < 2 || (payload[0] | (payload[1] << 8)) != frames)
+        {
+          status = IMPORT_INCOMPLETE;
+        }
+        break;
+      default:
+        status = IMPORT_CORRUPT;
+        break;
+    }
+  }
+  for (uint8_t i = 0; i < patchedCount; i++)
+  {
+    if (status != IMPORT_OK)
+    {
+      // Incomplete patch: retire the EEPROM ENTRY so reloadAll() rewrites MEMORY (the data before the import) elsewhere
+      EEPROM.put(patched[i] + 3, static_cast<uint32_t>(EEPROM_MAX_WRITES));
+      worn += sizeof(uint32_t);
+      continue;
+    }
+    // Seal the patched EEPROM ENTRY so it reads back as valid (WRITE_COUNT stays short of retiring the entry)
+    uint32_t writeCount = 0;
+    EEPROM.get(patched[i] + 3, writeCount);
+    if (writeCount < EEPROM_MAX_WRITES - 1)
+    {
+      EEPROM.put(patched[i] + 3, writeCount + 1);
+    }
+    EEPROM.put(patched[i] + 9 + patchedLength[i], EEPROManagerBase::checksum(patched[i] + 9, patchedLength[i]));
+    worn += 2 * sizeof(uint32_t);
+  }
+  // An import cannot be deferred, but its bytes still wear the EEPROM
+  EEPROManagerBudget::debit(worn);
+  if (written)
+  {
+    EEPROManagerBase::requestCommit();
+    EEPROManagerBase::reloadAll();
+  }
+  EEPROManagerBase::releaseCommit();
+  return status;
+}
+
+/**
+ * @brief Adds an EEPROManager to the transaction, members stay added for further commits
+ * 
+ * @param MANAGER EEPROManager to add
+ * @return uint8_t TRANSACTION_OK or TRANSACTION_FULL
+ */
+inline uint8_t EEPROManagerTransaction::add(EEPROManagerBase &MANAGER)
+{
+  if (_COUNT == EEPROMANAGER_TRANSACTION_ENTRIES)
+  {
+    return TRANSACTION_FULL;
+  }
+  _MEMBERS[_COUNT++] = &MANAGER;
+  return TRANSACTION_OK;
+}
+
+/**
+ * @brief Writes the changed members atomically, sharing a single commit on flash based EEPROMs
+ * 
+ * @details The journal data holds STATE (1), record count (1) and one record per changed member:
+ *   KEY (2) | ADDRESS (2) | WRITE_COUNT (4) | LENGTH (2) | DATA (LENGTH)
+ * 
+ * @return uint8_t TRANSACTION_OK or the reason nothing was written
+ */
+inline uint8_t EEPROManagerTransaction::commit()
+{
+  uint16_t journalAddress = journal();
+  if (journalAddress == 0xFFFF)
+  {
+    return TRANSACTION_SPACE;
+  }
+  uint16_t position = journalAddress + 9 + 2;
+  uint16_t limit = journalAddress + 9 + EEPROMANAGER_JOURNAL_SIZE;
+  uint8_t records = 0;
+  uint8_t priority = 0;
+  EEPROManagerBase::holdCommit();
+  for (uint8_t i = 0; i < _COUNT; i++)
+  {
+    uint16_t used = _MEMBERS[i]->stage(position, limit - position);
+    if (used == 0xFFFF)
+    {
+      // Journal too small: nothing has been written to the members yet
+      seal(journalAddress, EEPROMANAGER_JOURNAL_SIZE, 0);
+      EEPROManagerBase::releaseCommit();
+      return TRANSACTION_OVERFLOW;
+    }
+    position += used;
+    records += used != 0;
+    if (used != 0 && _MEMBERS[i]->priority() > priority)
+    {
+      priority = _MEMBERS[i]->priority();
+    }
+  }
+  // The journal ENTRY plus every member ENTRY (13 + LENGTH each, i.e. its 10 byte record header + 3) wear the EEPROM
+  uint32_t worn = 13 + EEPROMANAGER_JOURNAL_SIZE + (position - (journalAddress + 9 + 2)) + 3UL * records;
+  if (records && !EEPROManagerBudget::spend(worn > 0xFFFF ? 0xFFFF : worn, priority))
+  {
+    seal(journalAddress, EEPROMANAGER_JOURNAL_SIZE, 0);
+    EEPROManagerBase::releaseCommit();
+    return TRANSACTION_BUDGET;
+  }
+  if (records)
+  {
+    uint32_t writeCount = 0;
+    EEPROM.get(journalAddress + 3, writeCount);
+    EEPROM.put(journalAddress + 3, writeCount + 1);
+    EEPROM.put(journalAddress + 9 + 1, records);
+    // The journal CRC32 is the commit point: from here on the transaction completes, if need be through recover()
+    seal(journalAddress, EEPROMANAGER_JOURNAL_SIZE, 1);
+    replay(journalAddress, EEPROMANAGER_JOURNAL_SIZE);
+    seal(journalAddress, EEPROMANAGER_JOURNAL_SIZE, 0);
+    for (uint8_t i = 0; i < _COUNT; i++)
+    {
+      _MEMBERS[i]->refresh();
+    }
+    EEPROManagerBase::requestCommit();
+  }
+  EEPROManagerBase::releaseCommit();
+  return TRANSACTION_OK;
+}
+
+/**
+ * @brief Replays a sealed journal left behind by a reset and reloads every EEPROManager
+ * 
+ * @return true A journal was replayed
+ * @return false No transaction was interrupted
+ */
+inline bool EEPROManagerTransaction::recover()
+{
+  uint16_t length = 0;
+  uint16_t journalAddress = EEPROManagerBase::find(EEPROMANAGER_JOURNAL_KEY, length);
+  uint32_t journalCRC32 = 0;
+  if (journalAddress == 0xFFFF || length < 2 || EEPROM.read(journalAddress + 9) != 1)
+  {
+    return false;
+  }
+  EEPROM.get(journalAddress + 9 + length, journalCRC32);
+  if (EEPROManagerBase::checksum(journalAddress + 9, length) != journalCRC32)
+  {
+    // Reset before the journal was sealed: the members were never touched
+    return false;
+  }
+  EEPROManagerBase::holdCommit();
+  replay(journalAddress, length);
+  seal(journalAddress, length, 0);
+  EEPROManagerBase::requestCommit();
+  EEPROManagerBase::reloadAll();
+  EEPROManagerBase::releaseCommit();
+  return true;
+}
+
+/**
+ * @brief Returns the live journal, retiring a worn or resized one and appending a fresh one if needed
+ * 
+ * @return uint16_t ADDRESS of the journal or 0xFFFF if there is no space for it
+ */
+inline uint16_t EEPROManagerTransaction::journal()
+{
+  uint16_t length = 0;
+  uint16_t journalAddress = EEPROManagerBase::find(EEPROMANAGER_JOURNAL_KEY, length);
+  if (journalAddress != 0xFFFF)
+  {
+    uint32_t writeCount = 0;
+    EEPROM.get(journalAddress + 3, writeCount);
+    if (length == EEPROMANAGER_JOURNAL_SIZE && writeCount < EEPROM_MAX_WRITES - 1)
+    {
+      return journalAddress;
+    }
+    EEPROM.put(journalAddress + 3, static_cast<uint32_t>(EEPROM_MAX_WRITES));
+  }
+  journalAddress = EEPROManagerBase::end();
+  if (static_cast<uint32_t>(journalAddress) + 9 + EEPROMANAGER_JOURNAL_SIZE + 4 > EEPROM.length())
+  {
+    return 0xFFFF;
+  }
+  uint16_t journalKey = EEPROMANAGER_JOURNAL_KEY;
+  EEPROM.put(journalAddress, journalKey);
+  EEPROM.put(journalAddress + 2, crc8(static_cast<uint8_t*>(static_cast<void*>(&journalKey)), sizeof(uint8_t)));
+  EEPROM.put(journalAddress + 3, static_cast<uint32_t>(1));
+  EEPROM.put(journalAddress + 7, static_cast<uint16_t>(EEPROMANAGER_JOURNAL_SIZE));
+  for (uint16_t i = 0; i < EEPROMANAGER_JOURNAL_SIZE; i++)
+  {
+    EEPROM.write(journalAddress + 9 + i, 0);
+  }
+  seal(journalAddress, EEPROMANAGER_JOURNAL_SIZE, 0);
+  return journalAddress;
+}
+
+/**
+ * @brief Writes every journalled record into its EEPROM ENTRY, records whose EEPROM ENTRY moved are skipped
+ * 
+ * @param JOURNAL ADDRESS of the journal
+ * @param LENGTH Number of journal data bytes
+ */
+inline void EEPROManagerTransaction::replay(uint16_t JOURNAL, uint16_t LENGTH)
+{
+  uint8_t records = EEPROM.read(JOURNAL + 9 + 1);
+  uint32_t position = JOURNAL + 9 + 2;
+  uint32_t limit = JOURNAL + 9 + LENGTH;
+  for (uint8_t i = 0; i < records && position + 10 <= limit; i++)
+  {
+    uint16_t recordKey = 0;
+    uint16_t recordAddress = 0;
+    uint32_t recordWriteCount = 0;
+    uint16_t recordLength = 0;
+    EEPROM.get(position, recordKey);
+    EEPROM.get(position + 2, recordAddress);
+    EEPROM.get(position + 4, recordWriteCount);
+    EEPROM.get(position + 8, recordLength);
+    if (position + 10 + recordLength > limit)
+    {
+      break;
+    }
+    uint16_t entryKey = 0;
+    uint32_t entryWriteCount = 0;
+    uint16_t entryLength = 0;
+    if (EEPROManagerBase::header(recordAddress, entryKey, entryWriteCount, entryLength) && entryKey == recordKey && entryLength == recordLength)
+    {
+      for (uint16_t j = 0; j < recordLength; j++)
+      {
+        uint8_t value = EEPROM.read(position + 10 + j);
+        if (EEPROM.read(recordAddress + 9 + j) != value)
+        {
+          EEPROM.write(recordAddress + 9 + j, value);
+        }
+      }
+      EEPROM.put(recordAddress + 3, recordWriteCount);
+      EEPROM.put(recordAddress + 9 + recordLength, EEPROManagerBase::checksum(recordAddress + 9, recordLength));
+    }
+    position += 10 + recordLength;
+  }
+}
+
+/**
+ * @brief Writes the journal STATE (1 while it must be replayed, 0 once applied) and the journal CRC32
+ * 
+ * @param JOURNAL ADDRESS of the journal
+ * @param LENGTH Number of journal data bytes
+ * @param STATE Journal STATE
+ */
+inline void EEPROManagerTransaction::seal(uint16_t JOURNAL, uint16_t LENGTH, uint8_t STATE)
+{
+  EEPROM.put(JOURNAL + 9, STATE);
+  EEPROM.put(JOURNAL + 9 + LENGTH, EEPROManagerBase::checksum(JOURNAL + 9, LENGTH));
+}
+
+/**
+ * @brief Used during construction to locate and initialise the EEPROM
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::begin()
+{
+  EEPROMANAGER_LATENCY(BEGIN);
+  initialise();
+  if (reserved(_ENTRY_KEY))
+  {
+    // Reserved KEY: would be taken for the journal or erased EEPROM, never touch the EEPROM
+    return;
+  }
+  if (locate())
+  {
+    // Entry found: read EEPROMEntry from EEPROM
+    read();
+  }
+  else
+  {
+    // Uninitialised space: write EEPROMEntry to EEPROM
+    write(*_MEMORY);
+  }
+}
+
+/**
+ * @brief Initialisation routine for EEPROM
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::initialise()
+{
+  _ENTRY_CRC8 = crc8(static_cast<uint8_t*>(static_cast<void*>(&_ENTRY_KEY)),sizeof(uint8_t));
+  _ENTRY_WRITE_COUNT = 1;
+  _ENTRY_LENGTH = sizeof(T);
+  _ENTRY_CRC32 = checksum(*_MEMORY);
+}
+
+/**
+ * @brief Used to locate current entry in EEPROM
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint8_t Address location of EEPROM entry
+ */
+template <class T> uint8_t EEPROManager<T>::locate()
+{
+  // Set ADDRESS and return if space is valid
+  EEPROMANAGER_STAT_START(timer);
+  uint8_t validSpace = 0;
+  while (_ADDRESS < EEPROM.length())
+  {
+    // Look for EEPROMEntry: check if KEY valid in EEPROM
+    uint16_t EEPROMKey = 0;
+    uint8_t EEPROMCRC8 = 0;
+    EEPROM.get(_ADDRESS, EEPROMKey);
+    EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY), EEPROMCRC8);
+    EEPROMANAGER_STAT(LOCATE_STEPS, 1);
+    EEPROMANAGER_STAT(BYTES_READ, sizeof(EEPROMKey) + sizeof(EEPROMCRC8));
+    EEPROMANAGER_STAT(CRC_BYTES, sizeof(uint8_t));
+    if (crc8(static_cast<uint8_t*>(static_cast<void*>(&EEPROMKey)),sizeof(uint8_t)) == EEPROMCRC8)
+    {
+      // Valid EEPROMEntry: read header EEPROMEntry information and check if matching KEY
+      uint32_t EEPROMCount = 0;
+      uint16_t EEPROMLength = 0;
+      EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), EEPROMCount);
+      EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof(_ENTRY_WRITE_COUNT), EEPROMLength);
+      EEPROMANAGER_STAT(BYTES_READ, sizeof(EEPROMCount) + sizeof(EEPROMLength));
+      if (EEPROMKey == _ENTRY_KEY && EEPROMCount < EEPROM_MAX_WRITES)
+      {
+        // Matching KEY and WRITE_COUNT within limits:return 1
+        validSpace = 1;
+        break;          
+      }
+      else
+      {
+        // KEY valid but not matching or WRITE_COUNT exceeds maximum: move to next EEPROMEntry address
+        _ADDRESS += EEPROMLength + + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(_ENTRY_CRC32);
+      }
+    }
+    else
+    {
+      // Invliad space: return 0
+      validSpace = 0;
+      break;
+    }
+  }
+  EEPROMANAGER_STAT_STOP(LOCATE_MICROS, timer);
+  return validSpace;
+}
+
+/**
+ * @brief If values differ between the EEPROM and registered object (struct) the changed values are written to the EEPROM
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint32_t Entry write count
+ */
+template <class T> uint32_t EEPROManager<T>::update()
+{
+  EEPROMANAGER_LATENCY(UPDATE);
+  // Taken before the snapshot and CRC32 so the trace records the whole call
+  uint32_t start = EEPROMANAGER_TRACE_START();
+  if (_SEQLOCK)
+  {
+    // MEMORY has concurrent writers: work on a consistent snapshot, or try again on the next call
+    alignas(T) uint8_t copy[sizeof(T)];
+    T *data = static_cast<T*>(static_cast<void*>(copy));
+    if (snapshot(*data))
+    {
+      return persist(*data, checksum(*data), start);
+    }
+    #ifdef EEPROMANAGER_TRACE
+    EEPROManagerTraceRecord traceRecord = {start, _ENTRY_KEY, sizeof(T), 0, 0, static_cast<uint32_t>(micros()) - start};
+    EEPROManagerTrace::record(traceRecord);
+    #endif
+    return 0;
+  }
+  return persist(*_MEMORY, checksum(*_MEMORY), start);
+}
+
+/**
+ * @brief Checks whether MEMORY differs from the EEPROM ENTRY without writing it
+ * 
+ * @tparam T Object (struct) to manage
+ * @return true MEMORY has changed
+ * @return false MEMORY matches the EEPROM ENTRY (or writers kept a bound EEPROManagerSeqLock busy)
+ */
+template <class T> bool EEPROManager<T>::changed()
+{
+  if (_SEQLOCK)
+  {
+    alignas(T) uint8_t copy[sizeof(T)];
+    T *data = static_cast<T*>(static_cast<void*>(copy));
+    return snapshot(*data) && differs(*data, checksum(*data));
+  }
+  _CHANGED_CRC32 = checksum(*_MEMORY);
+  _CHANGED_VALID = true;
+  return differs(*_MEMORY, _CHANGED_CRC32);
+}
+
+/**
+ * @brief Updates the EEPROM ENTRY reusing the CRC32 calculated by the preceding changed()
+ * 
+ * @details Used by EEPROManagerRegistry::schedule(), which calls changed() and then flush() within the same call, so
+ * MEMORY cannot have changed in between unless it has concurrent writers, which must be guarded by a sequence lock.
+ * With a sequence lock bound, or without a preceding changed(), this is update().
+ * 
+ * @tparam T Object (struct) to manage
+ * @return uint32_t Entry write count, 0 if unchanged or deferred or 0xFFFFFFFF if the EEPROM is full
+ */
+template <class T> uint32_t EEPROManager<T>::flush()
+{
+  if (!_CHANGED_VALID || _SEQLOCK)
+  {
+    return update();
+  }
+  EEPROMANAGER_LATENCY(UPDATE);
+  _CHANGED_VALID = false;
+  return persist(*_MEMORY, _CHANGED_CRC32, EEPROMANAGER_TRACE_START());
+}
+
+/**
+ * @brief Writes DATA to the EEPROM ENTRY if it differs from the EEPROM ENTRY
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ * @param MEMORY_CRC32 checksum() of DATA
+ * @param START micros() when the calling update() began, recorded by the trace (0 without EEPROMANAGER_TRACE)
+ * @return uint32_t Entry write count, 0 if unchanged or 0xFFFFFFFF if the EEPROM is full or the KEY is reserved
+ */
+template <class T> uint32_t EEPROManager<T>::persist(const T &DATA, uint32_t MEMORY_CRC32, uint32_t START)
+{
+  if (reserved(_ENTRY_KEY))
+  {
+    return 0xFFFFFFFF;
+  }
+  // Compare MEMORY CRC32 to ENTRY CRC32
+  EEPROMANAGER_STAT(UPDATE_CALLS, 1);
+  #ifdef EEPROMANAGER_TRACE
+  EEPROManagerTraceRecord traceRecord = {START, _ENTRY_KEY, sizeof(T), 0, 0, 0};
+  #else
+  static_cast<void>(START);
+  #endif
+  uint32_t writeCount = 0;
+  const T *data = &DATA;
+  uint32_t memoryCRC32 = MEMORY_CRC32;
+  _CHANGED_VALID = false;
+  if (!differs(*data, memoryCRC32))
+  {
+    // Data matches: do nothing, dropping a change still waiting to settle
+    EEPROMANAGER_STAT(UNCHANGED, 1);
+    if (_DEBOUNCE)
+    {
+      _DEBOUNCE->settled(memoryCRC32, millis());
+    }
+  }
+  else if (_DEBOUNCE && !_DEBOUNCE->due(memoryCRC32, millis()))
+  {
+    // Data is still changing: write it once it has settled
+  }
+  else if (!EEPROManagerBudget::spend(sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T) + sizeof(_ENTRY_CRC32), priority()))
+  {
+    // Write budget exhausted: retry once it has been refilled
+  }
+  else
+  {
+    // Data has changed: write new data to EEPROM
+    #ifdef EEPROMANAGER_TRACE
+    traceRecord.CHANGED = EEPROManagerTrace::difference(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), static_cast<const uint8_t*>(static_cast<const void*>(data)), sizeof(T));
+    #endif
+    #ifdef EEPROMANAGER_PROFILE
+    profile(*data);
+    #endif
+    EEPROMANAGER_STAT_START(timer);
+    _ENTRY_WRITE_COUNT++;
+    _ENTRY_CRC32 = memoryCRC32;
+    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
+    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *data);
+    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), stored(*data));
+    EEPROMANAGER_STAT(BYTES_WRITTEN, sizeof(_ENTRY_WRITE_COUNT) + sizeof(T) + sizeof(_ENTRY_CRC32));
+    EEPROMANAGER_STAT_STOP(WRITE_MICROS, timer);
+    commit();
+    if (_ENTRY_WRITE_COUNT >= EEPROM_MAX_WRITES)
+    {
+      // Write count has been exceeded: locate uninitialised space for new EEPROMEntry
+      EEPROMANAGER_STAT(RELOCATIONS, 1);
+      locate();
+      if (_ADDRESS < (EEPROM.length() - (sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T) + sizeof(_ENTRY_CRC32))))
+      {
+        // Space left in EEPROM: write data to EEPROM
+        _ENTRY_WRITE_COUNT = 1;
+        write(*data);
+        writeCount = _ENTRY_WRITE_COUNT;
+      }
+      else
+      {
+        // No space left in EEPROM: throw exception
+        writeCount = 0xFFFFFFFF;
+      }
+    }
+    else
+    {
+      // Write count is within limits: return write count
+      writeCount = _ENTRY_WRITE_COUNT;
+    }
+  }
+  #ifdef EEPROMANAGER_TRACE
+  traceRecord.WRITE_COUNT = writeCount;
+  traceRecord.LATENCY = micros() - traceRecord.TIME;
+  EEPROManagerTrace::record(traceRecord);
+  #endif
+  return writeCount;
+}
+
+/**
+ * @brief Writes the EEPROM entry
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ */
+template <class T> void EEPROManager<T>::write(const T &DATA)
+{
+  EEPROMANAGER_LATENCY(WRITE);
+  EEPROMANAGER_STAT_START(timer);
+  EEPROM.put(_ADDRESS, _ENTRY_KEY);
+  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY), _ENTRY_CRC8);
+  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
+  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT), _ENTRY_LENGTH);
+  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), DATA);
+  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), stored(DATA));
+  EEPROMANAGER_STAT(BYTES_WRITTEN, sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof(_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T) + sizeof(_ENTRY_CRC32));
+  EEPROMANAGER_STAT_STOP(WRITE_MICROS, timer);
+  commit();
+}
+
+/**
+ * @brief Reads the EEPROM entry
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::read()
+{
+  EEPROMANAGER_STAT_START(timer);
+  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
+  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *_MEMORY);
+  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), _ENTRY_CRC32);
+  EEPROMANAGER_STAT(BYTES_READ, sizeof(_ENTRY_WRITE_COUNT) + sizeof(T) + sizeof(_ENTRY_CRC32));
+  EEPROMANAGER_STAT_STOP(READ_MICROS, timer);
+  if (_EXCLUDED_COUNT || _TOLERANCE_COUNT)
+  {
+    // The stored CRC32 covers the excluded and toleranced fields too: compare against the CRC32 without them
+    _ENTRY_CRC32 = checksum(*_MEMORY);
+  }
+}
+
+/**
+ * @brief Calculates the CRC32 of MEMORY or a snapshot of it
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ * @return uint32_t CRC32 of DATA
+ */
+template <class T> uint32_t EEPROManager<T>::checksum(const T &DATA)
+{
+  EEPROMANAGER_STAT_START(timer);
+  const uint8_t *bytes = static_cast<const uint8_t*>(static_cast<const void*>(&DATA));
+  if (!_EXCLUDED_COUNT && !_TOLERANCE_COUNT)
+  {
+    uint32_t memoryCRC32 = crc32(bytes, sizeof(T));
+    EEPROMANAGER_STAT(CRC_BYTES, sizeof(T));
+    EEPROMANAGER_STAT_STOP(CRC_MICROS, timer);
+    return memoryCRC32;
+  }
+  // Hash the gaps between the excluded and toleranced fields (merging both sorted lists), continuing the CRC32
+  uint32_t memoryCRC32 = 0;
+  uint16_t position = 0;
+  uint8_t excluded = 0;
+  uint8_t toleranced = 0;
+  while (position < sizeof(T))
+  {
+    uint16_t skipOffset = sizeof(T);
+    uint16_t skipSize = 0;
+    if (excluded < _EXCLUDED_COUNT && (toleranced == _TOLERANCE_COUNT || _EXCLUDED[excluded].OFFSET <= _TOLERANCES[toleranced].OFFSET))
+    {
+      skipOffset = _EXCLUDED[excluded].OFFSET;
+      skipSize = _EXCLUDED[excluded++].SIZE;
+    }
+    else if (toleranced < _TOLERANCE_COUNT)
+    {
+      skipOffset = _TOLERANCES[toleranced].OFFSET;
+      skipSize = _TOLERANCES[toleranced++].SIZE;
+    }
+    if (skipOffset > position)
+    {
+      memoryCRC32 = crc32(bytes + position, skipOffset - position, 0x04C11DB7, memoryCRC32);
+      EEPROMANAGER_STAT(CRC_BYTES, skipOffset - position);
+      position = skipOffset;
+    }
+    if (skipOffset + skipSize > position)
+    {
+      position = skipOffset + skipSize;
+    }
+  }
+  EEPROMANAGER_STAT_STOP(CRC_MICROS, timer);
+  return memoryCRC32;
+}
+
+/**
+ * @brief Returns the CRC32 stored in the EEPROM ENTRY for DATA, always covering all of DATA
+ * 
+ * @details Without excluded or toleranced fields this is the CRC32 already calculated by checksum(), it only needs
+ * hashing again when writing while fields are left out of checksum().
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA Data being written, _ENTRY_CRC32 must already hold its checksum()
+ * @return uint32_t CRC32 of DATA
+ */
+template <class T> uint32_t EEPROManager<T>::stored(const T &DATA)
+{
+  if (!_EXCLUDED_COUNT && !_TOLERANCE_COUNT)
+  {
+    return _ENTRY_CRC32;
+  }
+  EEPROMANAGER_STAT(CRC_BYTES, sizeof(T));
+  return crc32(static_cast<const uint8_t*>(static_cast<const void*>(&DATA)), sizeof(T));
+}
+
+/**
+ * @brief Decides whether DATA has to be written
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ * @param MEMORY_CRC32 checksum() of DATA
+ * @return true DATA differs outside the excluded and toleranced fields or a toleranced field moved beyond its threshold
+ * @return false DATA matches the EEPROM ENTRY closely enough
+ */
+template <class T> bool EEPROManager<T>::differs(const T &DATA, uint32_t MEMORY_CRC32)
+{
+  return MEMORY_CRC32 != _ENTRY_CRC32 || (_TOLERANCE_COUNT && moved(DATA));
+}
+
+/**
+ * @brief Compares every toleranced field of DATA with its value in the EEPROM ENTRY
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ * @return true A toleranced field moved beyond its threshold
+ * @return false All toleranced fields are within their thresholds
+ */
+template <class T> bool EEPROManager<T>::moved(const T &DATA)
+{
+  uint16_t dataAddress = _ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH);
+  const uint8_t *memory = static_cast<const uint8_t*>(static_cast<const void*>(&DATA));
+  uint8_t persisted[sizeof(double)];
+  for (uint8_t i = 0; i < _TOLERANCE_COUNT; i++)
+  {
+    const EEPROManagerTolerance &tolerance = _TOLERANCES[i];
+    if (tolerance.SIZE > sizeof(persisted))
+    {
+      continue;
+    }
+    for (uint8_t j = 0; j < tolerance.SIZE; j++)
+    {
+      persisted[j] = EEPROM.read(dataAddress + tolerance.OFFSET + j);
+    }
+    EEPROMANAGER_STAT(BYTES_READ, tolerance.SIZE);
+    if (tolerance.exceeded(tolerance.value(memory + tolerance.OFFSET), tolerance.value(persisted)))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Commits the EEPROM on boards where the EEPROM is emulated in flash
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::commit()
+{
+  #if defined(BOARD_RP2040) || defined(BOARD_ESP)
+  if (commitHeld())
+  {
+    // Commits are being batched: releaseCommit() will commit
+    return;
+  }
+  EEPROMANAGER_LATENCY(COMMIT);
+  EEPROMANAGER_STAT_START(timer);
+  EEPROM.commit();
+  EEPROMANAGER_STAT(COMMITS, 1);
+  EEPROMANAGER_STAT_STOP(COMMIT_MICROS, timer);
+  #endif
+}
+
+/**
+ * @brief Journals MEMORY for an EEPROManagerTransaction if it differs from the EEPROM ENTRY
+ * 
+ * @tparam T Object (struct) to manage
+ * @param ADDRESS EEPROM address of the journal record
+ * @param ROOM Journal bytes left
+ * @return uint16_t Bytes journalled, 0 if unchanged or 0xFFFF if the record does not fit
+ */
+template <class T> uint16_t EEPROManager<T>::stage(uint16_t ADDRESS, uint16_t ROOM)
+{
+  alignas(T) uint8_t copy[sizeof(T)];
+  T *data = static_cast<T*>(static_cast<void*>(copy));
+  if (reserved(_ENTRY_KEY))
+  {
+    return 0;
+  }
+  if (_SEQLOCK)
+  {
+    if (!snapshot(*data))
+    {
+      // Writers kept MEMORY busy: leave it to the next commit
+      return 0;
+    }
+  }
+  else
+  {
+    memcpy(copy, static_cast<const void*>(_MEMORY), sizeof(T));
+  }
+  if (!differs(*data, checksum(*data)))
+  {
+    return 0;
+  }
+  if (ROOM < 10 + sizeof(T))
+  {
+    return 0xFFFF;
+  }
+  uint32_t writeCount = _ENTRY_WRITE_COUNT < EEPROM_MAX_WRITES - 1 ? _ENTRY_WRITE_COUNT + 1 : _ENTRY_WRITE_COUNT;
+  EEPROM.put(ADDRESS, _ENTRY_KEY);
+  EEPROM.put(ADDRESS + 2, _ADDRESS);
+  EEPROM.put(ADDRESS + 4, writeCount);
+  EEPROM.put(ADDRESS + 8, _ENTRY_LENGTH);
+  EEPROM.put(ADDRESS + 10, *data);
+  return 10 + sizeof(T);
+}
+
+/**
+ * @brief Rereads WRITE_COUNT and CRC32 of the EEPROM ENTRY after a transaction wrote it
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManager<T>::refresh()
+{
+  if (reserved(_ENTRY_KEY))
+  {
+    return;
+  }
+  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
+  if (!_EXCLUDED_COUNT && !_TOLERANCE_COUNT)
+  {
+    EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), _ENTRY_CRC32);
+    return;
+  }
+  alignas(T) uint8_t copy[sizeof(T)];
+  T *data = static_cast<T*>(static_cast<void*>(copy));
+  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *data);
+  _ENTRY_CRC32 = checksum(*data);
+}
+
+#ifdef EEPROMANAGER_PROFILE
+/**
+ * @brief Compares MEMORY (or a snapshot of it) to the EEPROM ENTRY and counts the changed fields
+ * 
+ * @tparam T Object (struct) to manage
+ * @param DATA MEMORY or a snapshot of it
+ */
+template <class T> void EEPROManager<T>::profile(const T &DATA)
+{
+  uint16_t dataAddress = _ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH);
+  const uint8_t *memory = static_cast<const uint8_t*>(static_cast<const void*>(&DATA));
+  bool unmapped = false;
+  _PROFILE_WRITES++;
+  for (uint16_t i = 0; i < sizeof(T); i++)
+  {
+    if (EEPROM.read(dataAddress + i) != memory[i])
+    {
+      bool mapped = false;
+      for (uint8_t field = 0; field < _FIELD_COUNT; field++)
+      {
+        if (i >= _FIELDS[field].OFFSET && i < _FIELDS[field].OFFSET + _FIELDS[field].SIZE)
+        {
+          // Count each field once per write: skip the remaining bytes of the field
+          _FIELDS[field].CHANGES++;
+          i = _FIELDS[field].OFFSET + _FIELDS[field].SIZE - 1;
+          mapped = true;
+          break;
+        }
+      }
+      unmapped = unmapped || !mapped;
+    }
+  }
+  if (unmapped)
+  {
+    _PROFILE_UNMAPPED++;
+  }
+}
+#endif
+
+/**
+ * @brief Binds MEMORY and encodes it, so an EEPROM ENTRY created by the EEPROManager base holds MEMORY
+ * 
+ * @tparam T Object (struct) to manage
+ * @param MEMORY Pointer to object (struct) to manage
+ */
+template <class T> EEPROManagerSerialStorage<T>::EEPROManagerSerialStorage(T *MEMORY)
+{
+  _SERIAL_MEMORY = MEMORY;
+  encode();
+}
+
+/**
+ * @brief Serialises MEMORY into the staging buffer
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManagerSerialStorage<T>::encode()
+{
+  EEPROManagerEncoder encoder(_IMAGE.BYTES, sizeof(_IMAGE.BYTES));
+  EEPROManagerLayout<T>::visit(encoder, *_SERIAL_MEMORY);
+}
+
+/**
+ * @brief Deserialises the staging buffer into MEMORY
+ * 
+ * @tparam T Object (struct) to manage
+ */
+template <class T> void EEPROManagerSerialStorage<T>::decode()
+{
+  EEPROManagerDecoder decoder(_IMAGE.BYTES, sizeof(_IMAGE.BYTES));
+  EEPROManagerLayout<T>::visit(decoder, *_SERIAL_MEMORY);
+}
+
+/**
+ * @brief Construct a new EEPROManagerSerial<T>::EEPROManagerSerial object
+ * 
+ * @tparam T Object (struct) to manage
+ * @param MEMORY Pointer to object (struct) to manage
+ * @param KEY Unique identifier key for entry location in EEPROM
+ */
+template <class T> EEPROManagerSerial<T>::EEPROManagerSerial(T *MEMORY, uint16_t KEY)
+  : EEPROManagerStaged< EEPROManagerSerialStorage<T> >(EEPROManagerSerialStorage<T>(MEMORY), KEY)
+{
+}
+
+/**
+ * @brief Construct a new EEPROManagerStaged<STORAGE>::EEPROManagerStaged object
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ * @param STAGING Staging buffer already filled from MEMORY
+ * @param KEY Unique identifier key for entry location in EEPROM
+ */
+template <class STORAGE> EEPROManagerStaged<STORAGE>::EEPROManagerStaged(const STORAGE &STAGING, uint16_t KEY)
+  : STORAGE(STAGING), Manager(&this->_IMAGE, KEY)
+{
+  this->decode();
+}
+
+/**
+ * @brief Encodes MEMORY and updates the EEPROM ENTRY if the encoding has changed
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ * @return uint32_t Entry write count, 0 if unchanged or 0xFFFFFFFF if the EEPROM is full
+ */
+template <class STORAGE> uint32_t EEPROManagerStaged<STORAGE>::update()
+{
+  this->encode();
+  return Manager::update();
+}
+
+/**
+ * @brief Encodes MEMORY and checks whether it differs from the EEPROM ENTRY without writing it
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ * @return true MEMORY has changed
+ * @return false MEMORY matches the EEPROM ENTRY
+ */
+template <class STORAGE> bool EEPROManagerStaged<STORAGE>::changed()
+{
+  this->encode();
+  return Manager::changed();
+}
+
+/**
+ * @brief Synchronises flash based EEPROMs and decodes the EEPROM ENTRY into MEMORY
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ */
+template <class STORAGE> void EEPROManagerStaged<STORAGE>::synchronise()
+{
+  this->encode();
+  Manager::synchronise();
+  this->decode();
+}
+
+/**
+ * @brief Reloads the EEPROM ENTRY and decodes it into MEMORY
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ */
+template <class STORAGE> void EEPROManagerStaged<STORAGE>::reload()
+{
+  this->encode();
+  Manager::reload();
+  this->decode();
+}
+
+/**
+ * @brief Encodes MEMORY and journals it for an EEPROManagerTransaction
+ * 
+ * @tparam STORAGE Staging buffer and its encoding
+ * @param ADDRESS EEPROM address of the journal record
+ * @param ROOM Journal bytes left
+ * @return uint16_t Bytes journalled, 0 if unchanged or 0xFFFF if the record does not fit
+ */
+template <class STORAGE> uint16_t EEPROManagerStaged<STORAGE>::stage(uint16_t ADDRESS, uint16_t ROOM)
+{
+  this->encode();
+  return Manager::stage(ADDRESS, ROOM);
+}
+
+/**
+ * @brief Binds one part of MEMORY and gathers it into the staging buffer
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam SIZE Bytes of the part
+ * @param MEMORY Pointer to object (struct) to manage
+ * @param FIELDS Hot fields declared with EEPROMANAGER_FIELD(T, MEMBER), in ascending OFFSET order
+ * @param COUNT Number of hot fields
+ * @param HOT Bind the hot fields rather than the bytes between them
+ */
+template <class T, uint16_t SIZE> EEPROManagerSplitStorage<T, SIZE>::EEPROManagerSplitStorage(T *MEMORY, const EEPROManagerField *FIELDS, uint8_t COUNT, bool HOT)
+{
+  _SPLIT_MEMORY = MEMORY;
+  _HOT_FIELDS = FIELDS;
+  _HOT_COUNT = COUNT;
+  _HOT = HOT;
+  memset(_IMAGE.BYTES, 0, SIZE);
+  encode();
+}
+
+/**
+ * @brief Gathers the part of MEMORY into the staging buffer
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam SIZE Bytes of the part
+ */
+template <class T, uint16_t SIZE> void EEPROManagerSplitStorage<T, SIZE>::encode()
+{
+  copy(true);
+}
+
+/**
+ * @brief Scatters the staging buffer into the part of MEMORY
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam SIZE Bytes of the part
+ */
+template <class T, uint16_t SIZE> void EEPROManagerSplitStorage<T, SIZE>::decode()
+{
+  copy(false);
+}
+
+/**
+ * @brief Copies the byte ranges of the part between MEMORY and the staging buffer, never past either end
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam SIZE Bytes of the part
+ * @param GATHER Copy from MEMORY into the staging buffer rather than back
+ */
+template <class T, uint16_t SIZE> void EEPROManagerSplitStorage<T, SIZE>::copy(bool GATHER)
+{
+  uint8_t *memory = reinterpret_cast<uint8_t*>(_SPLIT_MEMORY);
+  uint16_t position = 0;
+  uint16_t gap = 0;
+  for (uint8_t i = 0; i <= _HOT_COUNT && position < SIZE; i++)
+  {
+    // The hot part copies each field, the cold part copies the gap in front of it (and finally the tail of T)
+    uint16_t start = i < _HOT_COUNT ? _HOT_FIELDS[i].OFFSET : sizeof(T);
+    uint16_t end = i < _HOT_COUNT ? start + _HOT_FIELDS[i].SIZE : sizeof(T);
+    uint16_t from = _HOT ? start : gap;
+    uint16_t to = _HOT ? end : start;
+    gap = end > gap ? end : gap;
+    if (to <= from || (_HOT && i == _HOT_COUNT))
+    {
+      continue;
+    }
+    uint16_t length = to - from < SIZE - position ? to - from : SIZE - position;
+    if (GATHER)
+    {
+      memcpy(_IMAGE.BYTES + position, memory + from, length);
+    }
+    else
+    {
+      memcpy(memory + from, _IMAGE.BYTES + position, length);
+    }
+    position += length;
+  }
+}
+
+/**
+ * @brief Construct a new EEPROManagerSplit<T, HOT_SIZE>::EEPROManagerSplit object
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ * @param MEMORY Pointer to object (struct) to manage
+ * @param HOT_FIELDS Hot fields declared with EEPROMANAGER_FIELD(T, MEMBER), in ascending OFFSET order
+ * @param COUNT Number of hot fields
+ * @param HOT_KEY Unique identifier key of the hot EEPROM ENTRY
+ * @param COLD_KEY Unique identifier key of the cold EEPROM ENTRY
+ */
+template <class T, uint16_t HOT_SIZE> EEPROManagerSplit<T, HOT_SIZE>::EEPROManagerSplit(T *MEMORY, const EEPROManagerField *HOT_FIELDS, uint8_t COUNT, uint16_t HOT_KEY, uint16_t COLD_KEY)
+  : _HOT(EEPROManagerSplitStorage<T, HOT_SIZE>(MEMORY, HOT_FIELDS, COUNT, true), HOT_KEY),
+    _COLD(EEPROManagerSplitStorage<T, sizeof(T) - HOT_SIZE>(MEMORY, HOT_FIELDS, COUNT, false), COLD_KEY)
+{
+}
+
+/**
+ * @brief Updates the hot and the cold EEPROM ENTRY if their part of MEMORY has changed
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ * @return uint32_t Write count of the hot entry if written, otherwise of the cold entry, 0 if unchanged or 0xFFFFFFFF if the EEPROM is full
+ */
+template <class T, uint16_t HOT_SIZE> uint32_t EEPROManagerSplit<T, HOT_SIZE>::update()
+{
+  uint32_t hotWrites = _HOT.update();
+  uint32_t coldWrites = _COLD.update();
+  if (hotWrites == 0xFFFFFFFF || coldWrites == 0xFFFFFFFF)
+  {
+    return 0xFFFFFFFF;
+  }
+  return hotWrites ? hotWrites : coldWrites;
+}
+
+/**
+ * @brief Checks whether either part of MEMORY differs from its EEPROM ENTRY without writing it
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ * @return true MEMORY has changed
+ * @return false MEMORY matches both EEPROM ENTRIES
+ */
+template <class T, uint16_t HOT_SIZE> bool EEPROManagerSplit<T, HOT_SIZE>::changed()
+{
+  bool hotChanged = _HOT.changed();
+  return _COLD.changed() || hotChanged;
+}
+
+/**
+ * @brief Synchronises flash based EEPROMs and reads both EEPROM ENTRIES into MEMORY
+ * 
+ * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ */
+template <class T, uint16_t HOT_SIZE> void EEPROManagerSplit<T, HOT_SIZE>::synchronise()
+{
+  _HOT.synchronise();
+  _COLD.synchronise();
+}
 
 /**
- * @brief Construct a new EEPROManager<T>::EEPROManager object
+ * @brief Reloads MEMORY from both EEPROM ENTRIES after the EEPROM was changed externally
  * 
  * @tparam T Object (struct) to manage
- * @param MEMORY Pointer to object (struct) to manager
- * @param KEY Unique identifier key for entry location in EEPROM
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
  */
-template <class T> EEPROManager<T>::EEPROManager(T *MEMORY, uint16_t KEY)
+template <class T, uint16_t HOT_SIZE> void EEPROManagerSplit<T, HOT_SIZE>::reload()
 {
-  _MEMORY = MEMORY;
-  _ENTRY_KEY = KEY;
-  #if !defined(BOARD_RP2040) || !defined(BOARD_ESP)
-  begin();
-  #endif
+  _HOT.reload();
+  _COLD.reload();
 }
 
 /**
- * @brief Synchronise settings for flash based EEPROMs
+ * @brief Returns the EEPROManager of the hot part, e.g. to set its priority() or deadline()
  * 
  * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ * @return Hot& EEPROManager of the hot fields
  */
-template <class T> void EEPROManager<T>::synchronise()
+template <class T, uint16_t HOT_SIZE> typename EEPROManagerSplit<T, HOT_SIZE>::Hot& EEPROManagerSplit<T, HOT_SIZE>::hot()
 {
-  #ifdef BOARD_RP2040
-  EEPROM.begin(4096);
-  begin();
-  #endif
-  #ifdef BOARD_ESP
-  EEPROM.begin(512);
-  begin();
-  #endif
+  return _HOT;
 }
 
 /**
- * @brief Resets the EEPROM by overwriting the values with 0xFF
+ * @brief Returns the EEPROManager of the cold part
  * 
  * @tparam T Object (struct) to manage
+ * @tparam HOT_SIZE Sum of the sizes of the hot fields
+ * @return Cold& EEPROManager of every byte outside the hot fields
  */
-template <class T> void EEPROManager<T>::reset()
+template <class T, uint16_t HOT_SIZE> typename EEPROManagerSplit<T, HOT_SIZE>::Cold& EEPROManagerSplit<T, HOT_SIZE>::cold()
 {
-  for (uint16_t i = 0 ; i < EEPROM.length() ; i++)
+  return _COLD;
+}
+
+/**
+ * @brief Packs the DEFAULT of every value into otherwise cleared bits
+ * 
+ * @tparam BITS Number of packed bits
+ * @param VALUES Values of the entry, or 0 for all zero defaults
+ * @param COUNT Number of values
+ */
+template <uint16_t BITS> EEPROManagerPackedStorage<BITS>::EEPROManagerPackedStorage(const EEPROManagerBits *VALUES, uint8_t COUNT)
+{
+  memset(_PACKED.BYTES, 0, sizeof(_PACKED.BYTES));
+  for (uint8_t i = 0; i < COUNT; i++)
   {
-    #ifndef BOARD_ESP
-    EEPROM.update(i, 0xFF);
-    #endif
-    #ifdef BOARD_ESP
-    byte currentByte = EEPROM.read(i);
-    if (currentByte != 0xFF)
+    for (uint8_t bit = 0; bit < VALUES[i].WIDTH && VALUES[i].BIT + bit < BITS; bit++)
     {
-      EEPROM.write(i, 0xFF);
+      uint16_t position = VALUES[i].BIT + bit;
+      _PACKED.BYTES[position >> 3] |= ((VALUES[i].DEFAULT >> bit) & 1) << (position & 7);
     }
-    #endif
   }
-  #if defined(BOARD_RP2040) || defined(BOARD_ESP)
-  EEPROM.commit();
-  #endif
-  begin();
 }
 
 /**
- * @brief Prints the EEPROM dump to the assigned stream for printing and debugging
+ * @brief Construct a new EEPROManagerPacked<BITS>::EEPROManagerPacked object
  * 
- * @tparam T Object (struct) to manage
- * @param dump string literal hold dump
+ * @tparam BITS Number of packed bits
+ * @param KEY Unique identifier key for entry location in EEPROM
+ * @param VALUES Values of the entry, their DEFAULT is written when the EEPROM ENTRY is created
+ * @param COUNT Number of values
  */
-template <class T> void EEPROManager<T>::print(Stream* stream)
+template <uint16_t BITS> EEPROManagerPacked<BITS>::EEPROManagerPacked(uint16_t KEY, const EEPROManagerBits *VALUES, uint8_t COUNT)
+  : EEPROManagerPackedStorage<BITS>(VALUES, COUNT), EEPROManager< EEPROManagerBytes<(BITS + 7) / 8> >(&this->_PACKED, KEY)
 {
-  for (uint16_t i=0; i<EEPROM.length(); i++)
+}
+
+/**
+ * @brief Returns a value, bits past BITS read as zero
+ * 
+ * @tparam BITS Number of packed bits
+ * @param VALUE Value descriptor
+ * @return uint32_t Value
+ */
+template <uint16_t BITS> uint32_t EEPROManagerPacked<BITS>::get(const EEPROManagerBits &VALUE) const
+{
+  uint32_t data = 0;
+  for (uint8_t bit = 0; bit < VALUE.WIDTH && bit < 32; bit++)
   {
-    stream->printf("%02X ", EEPROM.read(i));
+    data |= static_cast<uint32_t>(flag(VALUE.BIT + bit)) << bit;
   }
-  stream->printf("\n");
+  return data;
 }
 
 /**
- * @brief Used during construction to locate and initialise the EEPROM
+ * @brief Sets a value in RAM, written by the next update()
  * 
- * @tparam T Object (struct) to manage
+ * @tparam BITS Number of packed bits
+ * @param VALUE Value descriptor
+ * @param DATA Value, bits beyond its WIDTH are dropped
  */
-template <class T> void EEPROManager<T>::begin()
+template <uint16_t BITS> void EEPROManagerPacked<BITS>::set(const EEPROManagerBits &VALUE, uint32_t DATA)
 {
-  initialise();
-  if (locate())
+  for (uint8_t bit = 0; bit < VALUE.WIDTH && bit < 32; bit++)
   {
-    // Entry found: read EEPROMEntry from EEPROM
-    read();
+    flag(VALUE.BIT + bit, (DATA >> bit) & 1);
+  }
+}
+
+/**
+ * @brief Returns a single bit
+ * 
+ * @tparam BITS Number of packed bits
+ * @param BIT Bit position
+ * @return true The bit is set
+ * @return false The bit is clear or past BITS
+ */
+template <uint16_t BITS> bool EEPROManagerPacked<BITS>::flag(uint16_t BIT) const
+{
+  return BIT < BITS && ((this->_PACKED.BYTES[BIT >> 3] >> (BIT & 7)) & 1);
+}
+
+/**
+ * @brief Sets a single bit in RAM, written by the next update()
+ * 
+ * @tparam BITS Number of packed bits
+ * @param BIT Bit position, ignored past BITS
+ * @param STATE New state of the bit
+ */
+template <uint16_t BITS> void EEPROManagerPacked<BITS>::flag(uint16_t BIT, bool STATE)
+{
+  if (BIT >= BITS)
+  {
+    return;
+  }
+  if (STATE)
+  {
+    this->_PACKED.BYTES[BIT >> 3] |= 1 << (BIT & 7);
   }
   else
   {
-    // Uninitialised space: write EEPROMEntry to EEPROM
-    write();
+    this->_PACKED.BYTES[BIT >> 3] &= ~(1 << (BIT & 7));
   }
 }
 
 /**
- * @brief Initialisation routine for EEPROM
+ * @brief Walks the EEPROM ENTRY chain once and indexes every live EEPROM ENTRY not managed by an EEPROManager, call
+ * after synchronise() on flash based boards
  * 
- * @tparam T Object (struct) to manage
+ * @return uint16_t Number of EEPROM ENTRIES indexed
  */
-template <class T> void EEPROManager<T>::initialise()
+inline uint16_t EEPROManagerStore::begin()
 {
-  _ENTRY_CRC8 = crc8(static_cast<uint8_t*>(static_cast<void*>(&_ENTRY_KEY)),sizeof(uint8_t));
-  _ENTRY_WRITE_COUNT = 1;
-  _ENTRY_LENGTH = sizeof(T);
-  _ENTRY_CRC32 = crc32(static_cast<uint8_t*>(static_cast<void*>(_MEMORY)),sizeof(T));
+  for (uint16_t i = 0; i < EEPROMANAGER_STORE_SLOTS; i++)
+  {
+    _SLOTS[i].ADDRESS = EMPTY;
+  }
+  _BEGUN = true;
+  _OVERFLOW = false;
+  uint16_t indexed = 0;
+  uint16_t entryKey = 0;
+  uint32_t writeCount = 0;
+  uint16_t length = 0;
+  uint32_t address = 0;
+  for (; EEPROManagerBase::header(address, entryKey, writeCount, length); address += 9 + length + 4)
+  {
+    if (writeCount < EEPROM_MAX_WRITES && entryKey != EEPROMANAGER_JOURNAL_KEY && !owned(entryKey))
+    {
+      // Only the first live EEPROM ENTRY of a KEY is ever used, the same as locate()
+      uint16_t indexedLength = 0;
+      if (lookup(entryKey, indexedLength) == 0xFFFF)
+      {
+        if (index(entryKey, address))
+        {
+          indexed++;
+        }
+        else
+        {
+          _OVERFLOW = true;
+        }
+      }
+    }
+  }
+  _END = address < EEPROM.length() ? address : EEPROM.length();
+  return indexed;
 }
 
 /**
- * @brief Used to locate current entry in EEPROM
+ * @brief Writes a value, in place if its LENGTH is unchanged or as a new EEPROM ENTRY otherwise
  * 
- * @tparam T Object (struct) to manage
- * @return uint8_t Address location of EEPROM entry
+ * @param KEY Unique KEY of the value
+ * @param DATA Value bytes
+ * @param LENGTH Number of value bytes
+ * @return uint32_t WRITE_COUNT of the EEPROM ENTRY, 0 if unchanged or deferred by the EEPROManagerBudget (put() again
+ * later) or 0xFFFFFFFF if the EEPROM is full or KEY is reserved (EEPROMANAGER_JOURNAL_KEY, 0xFFFF or the KEY of an
+ * EEPROManager)
  */
-template <class T> uint8_t EEPROManager<T>::locate()
+inline uint32_t EEPROManagerStore::put(uint16_t KEY, const void *DATA, uint16_t LENGTH)
 {
-  // Set ADDRESS and return if space is valid
-  uint8_t validSpace = 0;
-  while (_ADDRESS < EEPROM.length())
+  if (reserved(KEY))
   {
-    // Look for EEPROMEntry: check if KEY valid in EEPROM
-    uint16_t EEPROMKey = 0;
-    uint8_t EEPROMCRC8 = 0;
-    EEPROM.get(_ADDRESS, EEPROMKey);
-    EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY), EEPROMCRC8);
-    if (crc8(static_cast<uint8_t*>(static_cast<void*>(&EEPROMKey)),sizeof(uint8_t)) == EEPROMCRC8)
+    return 0xFFFFFFFF;
+  }
+  const uint8_t *bytes = static_cast<const uint8_t*>(DATA);
+  uint32_t dataCRC32 = crc32(bytes, LENGTH);
+  uint16_t length = 0;
+  uint16_t address = lookup(KEY, length);
+  if (address != 0xFFFF && length == LENGTH)
+  {
+    uint32_t writeCount = 0;
+    uint32_t storedCRC32 = 0;
+    EEPROM.get(address + 3, writeCount);
+    EEPROM.get(address + 9 + length, storedCRC32);
+    if (storedCRC32 == dataCRC32)
     {
-      // Valid EEPROMEntry: read header EEPROMEntry information and check if matching KEY
-      uint32_t EEPROMCount = 0;
-      uint16_t EEPROMLength = 0;
-      EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), EEPROMCount);
-      EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof(_ENTRY_WRITE_COUNT), EEPROMLength);
-      if (EEPROMKey == _ENTRY_KEY && EEPROMCount < EEPROM_MAX_WRITES)
-      {
-        // Matching KEY and WRITE_COUNT within limits:return 1
-        validSpace = 1;
-        break;          
-      }
-      else
+      return 0;
+    }
+    if (writeCount < EEPROM_MAX_WRITES - 1)
+    {
+      if (!EEPROManagerBudget::spend(13 + LENGTH, 0))
       {
-        // KEY valid but not matching or WRITE_COUNT exceeds maximum: move to next EEPROMEntry address
-        _ADDRESS += EEPROMLength + + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(_ENTRY_CRC32);
+        return 0;
       }
+      writeCount++;
+      EEPROM.put(address + 3, writeCount);
+      write(address + 9, bytes, LENGTH);
+      EEPROM.put(address + 9 + LENGTH, dataCRC32);
+      EEPROManagerBase::requestCommit();
+      return writeCount;
     }
-    else
+  }
+  uint16_t entryAddress = tail();
+  if (static_cast<uint32_t>(entryAddress) + 9 + LENGTH + 4 > EEPROM.length())
+  {
+    return 0xFFFFFFFF;
+  }
+  if (!EEPROManagerBudget::spend(13 + LENGTH, 0))
+  {
+    return 0;
+  }
+  if (address == 0xFFFF && !index(KEY, entryAddress))
+  {
+    // Index full: the value is still written and found by walking the chain
+    _OVERFLOW = true;
+  }
+  EEPROM.put(entryAddress, KEY);
+  EEPROM.put(entryAddress + 2, crc8(static_cast<uint8_t*>(static_cast<void*>(&KEY)), sizeof(uint8_t)));
+  EEPROM.put(entryAddress + 3, static_cast<uint32_t>(1));
+  EEPROM.put(entryAddress + 7, LENGTH);
+  write(entryAddress + 9, bytes, LENGTH);
+  EEPROM.put(entryAddress + 9 + LENGTH, dataCRC32);
+  _END = entryAddress + 9 + LENGTH + 4;
+  if (address != 0xFFFF)
+  {
+    // Retired only once the new EEPROM ENTRY is complete
+    EEPROM.put(address + 3, static_cast<uint32_t>(EEPROM_MAX_WRITES));
+    if (!index(KEY, entryAddress))
     {
-      // Invliad space: return 0
-      validSpace = 0;
-      break;
+      _OVERFLOW = true;
     }
   }
-  return validSpace;
+  EEPROManagerBase::requestCommit();
+  return 1;
 }
 
 /**
- * @brief If values differ between the EEPROM and registered object (struct) the changed values are written to the EEPROM
+ * @brief Copies a value into BUFFER
  * 
- * @tparam T Object (struct) to manage
- * @return uint32_t Entry write count
+ * @param KEY Unique KEY of the value
+ * @param BUFFER Receives up to SIZE bytes of the value
+ * @param SIZE Size of BUFFER
+ * @return uint16_t LENGTH of the value, 0 if there is none or it fails its CRC32, more than SIZE if the value was
+ * truncated
  */
-template <class T> uint32_t EEPROManager<T>::update()
+inline uint16_t EEPROManagerStore::get(uint16_t KEY, void *BUFFER, uint16_t SIZE)
 {
-  // Compare MEMORY CRC32 to ENTRY CRC32
-  if (crc32(static_cast<uint8_t*>(static_cast<void*>(_MEMORY)),sizeof(T)) == _ENTRY_CRC32)
+  uint16_t length = 0;
+  uint16_t address = lookup(KEY, length);
+  uint32_t storedCRC32 = 0;
+  if (address == 0xFFFF)
   {
-    // Data matches: do nothing
     return 0;
   }
-  else
+  EEPROM.get(address + 9 + length, storedCRC32);
+  if (EEPROManagerBase::checksum(address + 9, length) != storedCRC32)
   {
-    // Data has changed: write new data to EEPROM
-    _ENTRY_WRITE_COUNT++;
-    _ENTRY_CRC32 = crc32(static_cast<uint8_t*>(static_cast<void*>(_MEMORY)),sizeof(T));
-    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
-    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *_MEMORY);
-    EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), _ENTRY_CRC32);
-    #if defined(BOARD_RP2040) || defined(BOARD_ESP)
-    EEPROM.commit();
-    #endif
-    if (_ENTRY_WRITE_COUNT >= EEPROM_MAX_WRITES)
+    // In-place rewrite interrupted by a reset
+    return 0;
+  }
+  uint8_t *bytes = static_cast<uint8_t*>(BUFFER);
+  for (uint16_t i = 0; i < length && i < SIZE; i++)
+  {
+    bytes[i] = EEPROM.read(address + 9 + i);
+  }
+  return length;
+}
+
+/**
+ * @brief Returns the LENGTH of a value, e.g. to size the buffer passed to get()
+ * 
+ * @param KEY Unique KEY of the value
+ * @return uint16_t LENGTH of the value, 0 if there is none
+ */
+inline uint16_t EEPROManagerStore::length(uint16_t KEY)
+{
+  uint16_t length = 0;
+  return lookup(KEY, length) == 0xFFFF ? 0 : length;
+}
+
+/**
+ * @brief Retires the EEPROM ENTRY of a value, its space is only reclaimed by reset()
+ * 
+ * @param KEY Unique KEY of the value
+ * @return true The value was removed
+ * @return false There is no value with KEY or KEY is reserved
+ */
+inline bool EEPROManagerStore::remove(uint16_t KEY)
+{
+  uint16_t length = 0;
+  uint16_t address = reserved(KEY) ? 0xFFFF : lookup(KEY, length);
+  if (address == 0xFFFF)
+  {
+    return false;
+  }
+  EEPROM.put(address + 3, static_cast<uint32_t>(EEPROM_MAX_WRITES));
+  index(KEY, REMOVED);
+  EEPROManagerBase::requestCommit();
+  return true;
+}
+
+/**
+ * @brief Looks KEY up in the hash index, confirming the header is still there
+ * 
+ * @details Only when the index overflowed, or the EEPROM ENTRY was moved behind the back of the store, is the chain
+ * walked with EEPROManagerBase::find().
+ * 
+ * @param KEY Unique KEY of the value
+ * @param LENGTH Receives the LENGTH of the EEPROM ENTRY data
+ * @return uint16_t ADDRESS of the EEPROM ENTRY or 0xFFFF if there is none
+ */
+inline uint16_t EEPROManagerStore::lookup(uint16_t KEY, uint16_t &LENGTH)
+{
+  if (!_BEGUN)
+  {
+    begin();
+  }
+  uint16_t slot = static_cast<uint16_t>(KEY * 40503U) % EEPROMANAGER_STORE_SLOTS;
+  for (uint16_t probe = 0; probe < EEPROMANAGER_STORE_SLOTS; probe++)
+  {
+    const Slot &entry = _SLOTS[(slot + probe) % EEPROMANAGER_STORE_SLOTS];
+    if (entry.ADDRESS == EMPTY)
     {
-      // Write count has been exceeded: locate uninitialised space for new EEPROMEntry
-      locate();
-      if (_ADDRESS < (EEPROM.length() - (sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T) + sizeof(_ENTRY_CRC32))))
-      {
-        // Space left in EEPROM: write data to EEPROM
-        _ENTRY_WRITE_COUNT = 1;
-        write();
-        return _ENTRY_WRITE_COUNT;
-      }
-      else
-      {
-        // No space left in EEPROM: throw exception
-        return 0xFFFFFFFF;
-      }
+      break;
     }
-    else
+    if (entry.KEY != KEY)
     {
-      // Write count is within limits: return write count
-      return _ENTRY_WRITE_COUNT;
+      continue;
+    }
+    if (entry.ADDRESS == REMOVED)
+    {
+      return 0xFFFF;
+    }
+    uint16_t entryKey = 0;
+    uint32_t writeCount = 0;
+    if (EEPROManagerBase::header(entry.ADDRESS, entryKey, writeCount, LENGTH) && entryKey == KEY && writeCount < EEPROM_MAX_WRITES)
+    {
+      return entry.ADDRESS;
     }
+    uint16_t address = EEPROManagerBase::find(KEY, LENGTH);
+    index(KEY, address == 0xFFFF ? REMOVED : address);
+    return address;
   }
+  return _OVERFLOW ? EEPROManagerBase::find(KEY, LENGTH) : 0xFFFF;
 }
 
 /**
- * @brief Writes the EEPROM entry
+ * @brief Records the ADDRESS of KEY, replacing its slot or taking the first REMOVED or EMPTY one on its probe sequence
  * 
- * @tparam T Object (struct) to manage
+ * @param KEY Unique KEY of the value
+ * @param ADDRESS ADDRESS of the EEPROM ENTRY or REMOVED
+ * @return true The ADDRESS was recorded
+ * @return false The index is full
  */
-template <class T> void EEPROManager<T>::write()
+inline bool EEPROManagerStore::index(uint16_t KEY, uint16_t ADDRESS)
 {
-  EEPROM.put(_ADDRESS, _ENTRY_KEY);
-  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY), _ENTRY_CRC8);
-  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
-  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT), _ENTRY_LENGTH);
-  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *_MEMORY);
-  EEPROM.put(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), _ENTRY_CRC32);
-  #if defined(BOARD_RP2040) || defined(BOARD_ESP)
-  EEPROM.commit();
-  #endif
+  uint16_t slot = static_cast<uint16_t>(KEY * 40503U) % EEPROMANAGER_STORE_SLOTS;
+  uint16_t free = 0xFFFF;
+  for (uint16_t probe = 0; probe < EEPROMANAGER_STORE_SLOTS; probe++)
+  {
+    Slot &entry = _SLOTS[(slot + probe) % EEPROMANAGER_STORE_SLOTS];
+    if (entry.ADDRESS != EMPTY && entry.KEY == KEY)
+    {
+      entry.ADDRESS = ADDRESS;
+      return true;
+    }
+    if (entry.ADDRESS == REMOVED || entry.ADDRESS == EMPTY)
+    {
+      // Keep probing for KEY, but remember the first slot which can be taken
+      free = free == 0xFFFF ? (slot + probe) % EEPROMANAGER_STORE_SLOTS : free;
+    }
+    if (entry.ADDRESS == EMPTY)
+    {
+      break;
+    }
+  }
+  if (free == 0xFFFF)
+  {
+    return false;
+  }
+  _SLOTS[free].KEY = KEY;
+  _SLOTS[free].ADDRESS = ADDRESS;
+  return true;
 }
 
 /**
- * @brief Reads the EEPROM entry
+ * @brief Checks whether a constructed EEPROManager manages KEY, whose EEPROM ENTRY then does not belong to the store
  * 
- * @tparam T Object (struct) to manage
+ * @param KEY Unique KEY of an EEPROM ENTRY
+ * @return true An EEPROManager manages KEY
+ * @return false KEY is free for the store
  */
-template <class T> void EEPROManager<T>::read()
+inline bool EEPROManagerStore::owned(uint16_t KEY)
 {
-  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8), _ENTRY_WRITE_COUNT);
-  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH), *_MEMORY);
-  EEPROM.get(_ADDRESS + sizeof(_ENTRY_KEY) + sizeof(_ENTRY_CRC8) + sizeof (_ENTRY_WRITE_COUNT) + sizeof(_ENTRY_LENGTH) + sizeof(T), _ENTRY_CRC32);
-}
\ No newline at end of file
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->next())
+  {
+    if (manager->key() == KEY)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Checks whether KEY must not be written or removed through the store
+ * 
+ * @param KEY Unique KEY of a value
+ * @return true KEY is EEPROMANAGER_JOURNAL_KEY, the erased KEY 0xFFFF or managed by an EEPROManager
+ * @return false KEY may be used with the store
+ */
+inline bool EEPROManagerStore::reserved(uint16_t KEY)
+{
+  return KEY == EEPROMANAGER_JOURNAL_KEY || KEY == 0xFFFF || owned(KEY);
+}
+
+/**
+ * @brief Returns the end of the EEPROM ENTRY chain, continuing the walk from where it was last seen in case
+ * EEPROManagers appended EEPROM ENTRIES since
+ * 
+ * @return uint16_t ADDRESS of the first byte of uninitialised space
+ */
+inline uint16_t EEPROManagerStore::tail()
+{
+  uint16_t entryKey = 0;
+  uint32_t writeCount = 0;
+  uint16_t length = 0;
+  uint32_t address = _END;
+  while (EEPROManagerBase::header(address, entryKey, writeCount, length))
+  {
+    address += 9 + length + 4;
+  }
+  _END = address < EEPROM.length() ? address : EEPROM.length();
+  return _END;
+}
+
+/**
+ * @brief Writes the bytes of DATA which differ from the EEPROM, sparing EEPROM cells and flash pages
+ * 
+ * @param ADDRESS First EEPROM address
+ * @param DATA Bytes to write
+ * @param LENGTH Number of bytes
+ */
+inline void EEPROManagerStore::write(uint16_t ADDRESS, const uint8_t *DATA, uint16_t LENGTH)
+{
+  for (uint16_t i = 0; i < LENGTH; i++)
+  {
+    if (EEPROM.read(ADDRESS + i) != DATA[i])
+    {
+      EEPROM.write(ADDRESS + i, DATA[i]);
+    }
+  }
+}
@@ -0,0 +1,185 @@
+/**
+ * @file EEPROManagerTask.h
+ * @author Larry Colvin (pclabtools@projectcolvin.com)
+ * @brief FreeRTOS background persistence task for EEPROManager on ESP32 boards
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright PCLabTools(c) 2022
+ * 
+ */
+
+#include <EEPROManager.h>
+
+/**
+ * @brief Retry interval of deferred writes
+ * 
+ * @details Milliseconds after which the persistence task retries a pass that left an EEPROManager changed but
+ * unwritten, e.g. because a seqlock snapshot ran out of retries, instead of waiting for the next notify() or PERIOD.
+ */
+#ifndef EEPROMANAGER_TASK_RETRY
+  #define EEPROMANAGER_TASK_RETRY 100
+#endif
+
+/**
+ * @class EEPROManagerTask
+ * 
+ * @brief Persistence task which owns every EEPROManager
+ * 
+ * @details The task sleeps until notify() is called (or PERIOD expires), waits SETTLE milliseconds for further changes
+ * to arrive and then updates every EEPROManager with a single EEPROM commit. A pass leaving changes unwritten is
+ * retried after EEPROMANAGER_TASK_RETRY milliseconds. Application tasks only signal changes, all
+ * CRC calculation and flash I/O happens in the persistence task, whose core, priority and cadence are set centrally
+ * in begin(). MEMORY written by other tasks while the persistence task reads it should be guarded with an
+ * EEPROManagerSeqLock (EEPROManager::seqlock()).
+ */
+#if !defined(EEPROManagerTask_h) && (defined(BOARD_ESP) || defined(ESP32))
+
+  #define EEPROManagerTask_h
+
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/task.h>
+
+  class EEPROManagerTask
+  {
+    public:
+      static bool begin(uint32_t PERIOD = 0, uint32_t SETTLE = 50, UBaseType_t PRIORITY = 1, BaseType_t CORE = -1, uint32_t STACK = 4096); // Starts the persistence task
+      static void notify();                             // Signals that MEMORY of any EEPROManager has changed
+      static void notifyFromISR();                      // Signals a change from an interrupt service routine
+      static uint32_t passes();                         // Returns the number of update passes performed
+
+    private:
+      struct State
+      {
+        TaskHandle_t HANDLE;                            // Handle of the persistence task
+        TickType_t PERIOD;                              // Maximum ticks between update passes
+        TickType_t SETTLE;                              // Ticks to wait for further changes after a notification
+        volatile uint32_t PASSES;                       // Number of update passes performed
+      };
+      static State& state();                            // Returns the task state shared by all translation units
+      static bool pending();                            // Returns true if an EEPROManager is changed but unwritten
+      static void run(void *PARAMETERS);                // Task function
+  };
+
+/**
+ * @brief Returns the task state
+ * 
+ * @return EEPROManagerTask::State& Task state
+ */
+inline EEPROManagerTask::State& EEPROManagerTask::state()
+{
+  static State taskState = {NULL, portMAX_DELAY, 0, 0};
+  return taskState;
+}
+
+/**
+ * @brief Starts the persistence task, call after every EEPROManager has been synchronised
+ * 
+ * @param PERIOD Milliseconds after which the task updates even without a notification, 0 to only update when notified
+ * @param SETTLE Milliseconds to wait after a notification so bursts of changes share one commit
+ * @param PRIORITY FreeRTOS priority of the task
+ * @param CORE Core to pin the task to, -1 for the sibling of the calling core
+ * @param STACK Stack size of the task in bytes
+ * @return true The task was started
+ * @return false The task is already running or could not be created
+ */
+inline bool EEPROManagerTask::begin(uint32_t PERIOD, uint32_t SETTLE, UBaseType_t PRIORITY, BaseType_t CORE, uint32_t STACK)
+{
+  State &taskState = state();
+  if (taskState.HANDLE)
+  {
+    return false;
+  }
+  taskState.PERIOD = PERIOD ? pdMS_TO_TICKS(PERIOD) : portMAX_DELAY;
+  taskState.SETTLE = pdMS_TO_TICKS(SETTLE);
+  if (CORE < 0)
+  {
+    CORE = portNUM_PROCESSORS > 1 ? 1 - xPortGetCoreID() : 0;
+  }
+  return xTaskCreatePinnedToCore(run, "EEPROManager", STACK, NULL, PRIORITY, &taskState.HANDLE, CORE) == pdPASS;
+}
+
+/**
+ * @brief Signals that MEMORY of any EEPROManager has changed, notifications before the next pass are coalesced
+ * 
+ */
+inline void EEPROManagerTask::notify()
+{
+  if (state().HANDLE)
+  {
+    xTaskNotifyGive(state().HANDLE);
+  }
+}
+
+/**
+ * @brief Signals that MEMORY of any EEPROManager has changed from an interrupt service routine
+ * 
+ */
+inline void EEPROManagerTask::notifyFromISR()
+{
+  if (state().HANDLE)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(state().HANDLE, &woken);
+    if (woken)
+    {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of update passes performed
+ * 
+ * @return uint32_t Update passes
+ */
+inline uint32_t EEPROManagerTask::passes()
+{
+  return state().PASSES;
+}
+
+/**
+ * @brief Checks whether the last pass left an EEPROManager changed but unwritten
+ * 
+ * @return true An EEPROManager still differs from its EEPROM ENTRY
+ * @return false Every EEPROManager matches its EEPROM ENTRY
+ */
+inline bool EEPROManagerTask::pending()
+{
+  for (EEPROManagerBase *manager = EEPROManagerBase::first(); manager; manager = manager->next())
+  {
+    if (manager->changed())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Waits for notifications and updates every EEPROManager with a single commit per pass
+ * 
+ * @param PARAMETERS Unused
+ */
+inline void EEPROManagerTask::run(void *)
+{
+  State &taskState = state();
+  TickType_t retry = pdMS_TO_TICKS(EEPROMANAGER_TASK_RETRY);
+  retry = retry ? retry : 1;
+  TickType_t wait = taskState.PERIOD;
+  for (;;)
+  {
+    if (ulTaskNotifyTake(pdTRUE, wait) && taskState.SETTLE)
+    {
+      // Let a burst of changes settle, absorbing the notifications it raises
+      vTaskDelay(taskState.SETTLE);
+      ulTaskNotifyTake(pdTRUE, 0);
+    }
+    EEPROManagerRegistry::updateAll();
+    taskState.PASSES++;
+    // An update() returned 0 without writing its change: retry rather than wait for a notify()
+    wait = retry < taskState.PERIOD && pending() ? retry : taskState.PERIOD;
+  }
+}
+
+#endif